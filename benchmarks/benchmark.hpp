@@ -0,0 +1,103 @@
+// Minimal benchmark harness: each benchmark is timed over several
+// repetitions (keeping the best), the heap allocations made while it runs are
+// counted, and the result is printed as a single line of JSON (see `make
+// bench`, which collects these lines into one report).
+//
+// Note: this header replaces the global allocation functions (to count the
+// allocations), so it must be included by exactly one translation unit, i.e.,
+// each benchmark is a single source file.
+
+#ifndef TRIUMF_BENCHMARKS_BENCHMARK_HPP
+#define TRIUMF_BENCHMARKS_BENCHMARK_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+namespace benchmark {
+
+/// number of heap allocations so far
+inline std::atomic<std::size_t> allocations(0);
+
+/// Keep the compiler from optimizing away a result.
+template <typename T> void do_not_optimize(const T &value) {
+  asm volatile("" : : "r"(&value) : "memory");
+}
+
+/// timing of a benchmark
+struct Result {
+  /// time per call (ns), best of the repetitions
+  double ns_per_call;
+  /// number of timed calls (over all of the repetitions)
+  std::size_t evaluations;
+  /// heap allocations per call (averaged over all of the repetitions)
+  double allocations_per_call;
+};
+
+/// \brief Time a benchmark, where each call of function performs n_calls
+/// evaluations of the code under test.
+template <typename Function>
+Result run(Function function, std::size_t n_calls, int n_repetitions = 10) {
+  // (warm up any caches, lazily initialized tables, etc.)
+  function();
+  double best = 0.0;
+  const std::size_t start_allocations = allocations.load();
+  for (int r = 0; r < n_repetitions; ++r) {
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    const auto stop = std::chrono::steady_clock::now();
+    const double elapsed =
+        std::chrono::duration<double, std::nano>(stop - start).count();
+    if (r == 0 or elapsed < best) {
+      best = elapsed;
+    }
+  }
+  const std::size_t n_allocations = allocations.load() - start_allocations;
+  const std::size_t evaluations = n_calls * n_repetitions;
+  return {best / n_calls, evaluations,
+          static_cast<double>(n_allocations) / evaluations};
+}
+
+/// Print a result as one line of JSON.
+inline void report(const std::string &group, const std::string &name,
+                   const Result &result) {
+  std::printf("{\"group\": \"%s\", \"name\": \"%s\", \"ns_per_call\": %.6g, "
+              "\"evaluations\": %zu, \"allocations_per_call\": %.6g}\n",
+              group.c_str(), name.c_str(), result.ns_per_call,
+              result.evaluations, result.allocations_per_call);
+  std::fflush(stdout);
+}
+
+/// Time a benchmark and print its result.
+template <typename Function>
+void measure(const std::string &group, const std::string &name,
+             Function function, std::size_t n_calls, int n_repetitions = 10) {
+  report(group, name, run(function, n_calls, n_repetitions));
+}
+
+} // namespace benchmark
+
+// replacement allocation functions (counting every allocation; the array
+// forms forward to these), kept out of line so that the compiler does not pair
+// the inlined malloc/free with new/delete (-Wmismatched-new-delete)
+__attribute__((noinline)) void *operator new(std::size_t size) {
+  benchmark::allocations.fetch_add(1, std::memory_order_relaxed);
+  if (void *p = std::malloc(size > 0 ? size : 1)) {
+    return p;
+  }
+  throw std::bad_alloc();
+}
+
+__attribute__((noinline)) void operator delete(void *p) noexcept {
+  std::free(p);
+}
+
+__attribute__((noinline)) void operator delete(void *p, std::size_t) noexcept {
+  std::free(p);
+}
+
+#endif // TRIUMF_BENCHMARKS_BENCHMARK_HPP
@@ -0,0 +1,71 @@
+// Per-point cost of quadrupole-split lithium-8 resonance spectra (i.e., the
+// asymmetry over a frequency scan spanning its four lines), by per-point
+// calls & by batch evaluation, with & without the parameter gradient.
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <triumf/bnmr/nuclei.hpp>
+#include <triumf/bnmr/resonance/lineshape.hpp>
+#include <triumf/bnmr/resonance/spectrum.hpp>
+#include <triumf/numpy.hpp>
+
+#include "benchmark.hpp"
+
+template <template <typename> class Lineshape>
+void measure(const std::string &name,
+             const std::array<double, Lineshape<double>::n_parameters> &shape) {
+  namespace resonance = triumf::bnmr::resonance;
+  typedef resonance::QuadrupoleSplitResonance<
+      Lineshape, triumf::bnmr::nuclei::lithium_8, double>
+      Model;
+  // (Hz) lines at 41.27 MHz ± 1.5 & 0.5 times 2 kHz
+  const Model model(0.1, 41.27e6, 2e3, shape, {0.3, 0.2, 0.2, 0.3});
+  const std::size_t n = 20000;
+  const std::vector<double> frequency =
+      triumf::numpy::linspace<double>(41.25e6, 41.29e6, n);
+  std::vector<double> result(n), gradient(n * Model::n_parameters);
+  benchmark::measure(
+      "bnmr::resonance", name,
+      [&]() {
+        for (std::size_t i = 0; i < n; ++i) {
+          result[i] = model(frequency[i]);
+        }
+        benchmark::do_not_optimize(result[n / 2]);
+      },
+      n);
+  benchmark::measure(
+      "bnmr::resonance", name + " (batch)",
+      [&]() {
+        model.evaluate(frequency.data(), n, result.data());
+        benchmark::do_not_optimize(result[n / 2]);
+      },
+      n);
+  benchmark::measure(
+      "bnmr::resonance", name + " & gradient",
+      [&]() {
+        for (std::size_t i = 0; i < n; ++i) {
+          result[i] = model(frequency[i], &gradient[i * Model::n_parameters]);
+        }
+        benchmark::do_not_optimize(gradient[n / 2]);
+      },
+      n);
+  benchmark::measure(
+      "bnmr::resonance", name + " & gradient (batch)",
+      [&]() {
+        model.evaluate(frequency.data(), n, result.data(), gradient.data());
+        benchmark::do_not_optimize(gradient[n / 2]);
+      },
+      n);
+}
+
+int main() {
+  namespace resonance = triumf::bnmr::resonance;
+  measure<resonance::Lorentzian>("lithium_8 Lorentzian", {300.0});
+  measure<resonance::Gaussian>("lithium_8 Gaussian", {250.0});
+  measure<resonance::PseudoVoigt>("lithium_8 pseudo-Voigt", {500.0, 0.5});
+  measure<resonance::Voigt>("lithium_8 Voigt", {200.0, 150.0});
+  return 0;
+}
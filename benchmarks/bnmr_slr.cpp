@@ -0,0 +1,97 @@
+// Cost of the pulsed SLR models, point by point (i.e., the ROOT adapters) and
+// for a whole histogram at once (i.e., triumf::bnmr::slr::evaluate), for a
+// typical lithium-8 measurement.
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <triumf/bnmr/nuclei.hpp>
+#include <triumf/bnmr/slr/bi_exp.hpp>
+#include <triumf/bnmr/slr/cbrt_exp.hpp>
+#include <triumf/bnmr/slr/common.hpp>
+#include <triumf/bnmr/slr/exp.hpp>
+#include <triumf/bnmr/slr/gauss_dist_exp.hpp>
+#include <triumf/bnmr/slr/magnesium_31/exp.hpp>
+#include <triumf/bnmr/slr/mod_str_exp.hpp>
+#include <triumf/bnmr/slr/sq_exp.hpp>
+#include <triumf/bnmr/slr/sqrt_exp.hpp>
+#include <triumf/bnmr/slr/str_exp.hpp>
+#include <triumf/numpy.hpp>
+
+#include "benchmark.hpp"
+
+// time both the point-wise function and the batch evaluation of a model
+template <typename Model>
+void measure_model(const std::string &name,
+                   double (*function)(const double *, const double *),
+                   const double *par, const std::vector<double> &time) {
+  benchmark::measure(
+      "bnmr::slr", name,
+      [&]() {
+        for (const double t : time) {
+          benchmark::do_not_optimize(function(&t, par));
+        }
+      },
+      time.size());
+  std::vector<double> result;
+  benchmark::measure(
+      "bnmr::slr", name + " (batch)",
+      [&]() {
+        triumf::bnmr::slr::evaluate<Model>(time, par, result);
+        benchmark::do_not_optimize(result.front());
+      },
+      time.size());
+}
+
+int main() {
+  namespace slr = triumf::bnmr::slr;
+  // a 4 s beam pulse and 16 s of data (in 10 ms bins)
+  const double lifetime = triumf::bnmr::nuclei::lithium_8<double>::lifetime();
+  const double pulse_length = 4.0;
+  const double asymmetry = 0.1;
+  const double slr_rate = 1.0;
+  const std::vector<double> time =
+      triumf::numpy::linspace<double>(0.005, 15.995, 1600);
+
+  const double exp_par[] = {lifetime, pulse_length, asymmetry, slr_rate};
+  measure_model<slr::PulsedExp<double>>("pulsed_exp", slr::pulsed_exp<double>,
+                                        exp_par, time);
+  measure_model<slr::PulsedSqExp<double>>(
+      "pulsed_sq_exp", slr::pulsed_sq_exp<double>, exp_par, time);
+  measure_model<slr::PulsedSqrtExp<double>>(
+      "pulsed_sqrt_exp", slr::pulsed_sqrt_exp<double>, exp_par, time);
+  measure_model<slr::PulsedCbrtExp<double>>(
+      "pulsed_cbrt_exp", slr::pulsed_cbrt_exp<double>, exp_par, time);
+
+  const double str_exp_par[] = {lifetime, pulse_length, asymmetry, slr_rate,
+                                0.6};
+  measure_model<slr::PulsedStrExp<double>>(
+      "pulsed_str_exp", slr::pulsed_str_exp<double>, str_exp_par, time);
+
+  const double mod_str_exp_par[] = {
+      lifetime, pulse_length, asymmetry, 2.0 * slr_rate, slr_rate, 0.5};
+  measure_model<slr::PulsedModStrExp<double>>(
+      "pulsed_mod_str_exp", slr::pulsed_mod_str_exp<double>, mod_str_exp_par,
+      time);
+
+  const double bi_exp_par[] = {lifetime, pulse_length, asymmetry,
+                               0.75,     slr_rate,     10.0};
+  measure_model<slr::PulsedBiExp<double>>(
+      "pulsed_bi_exp", slr::pulsed_bi_exp<double>, bi_exp_par, time);
+
+  const double gauss_dist_exp_par[] = {lifetime, pulse_length, asymmetry,
+                                       slr_rate, 0.1 * slr_rate};
+  measure_model<slr::PulsedGaussDistExp<double>>(
+      "pulsed_gauss_dist_exp", slr::pulsed_gauss_dist_exp<double>,
+      gauss_dist_exp_par, time);
+
+  // magnesium-31 (with decay corrections)
+  const double magnesium_31_par[] = {
+      triumf::bnmr::nuclei::magnesium_31<double>::lifetime(), 1.0, asymmetry,
+      slr_rate};
+  measure_model<slr::magnesium_31::PulsedExp<double>>(
+      "magnesium_31::pulsed_exp", slr::magnesium_31::pulsed_exp<double>,
+      magnesium_31_par, time);
+  return 0;
+}
@@ -0,0 +1,69 @@
+// Cost of the depth-averaged SLR rate of the local (London) and nonlocal
+// (Pippard/BCS) models for niobium, by adaptive (tanh-sinh) and fixed-node
+// (Gauss-Jacobi) quadrature, over an implantation energy scan. Requires ROOT
+// (to read the stopping profile's CSV file, which may be given as the first
+// argument).
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <triumf/bnmr/srf/local.hpp>
+#include <triumf/bnmr/srf/nonlocal.hpp>
+#include <triumf/numpy.hpp>
+
+#include "benchmark.hpp"
+
+int main(int argc, char *argv[]) {
+  namespace srf = triumf::bnmr::srf;
+  const std::string csv_filename =
+      argc > 1 ? argv[1] : "examples/srim_profile_8li_nb_fitpar.csv";
+  // implantation energies (keV)
+  const std::vector<double> energies =
+      triumf::numpy::linspace<double>(1.0, 25.0, 25);
+
+  const srf::local::DepthResolvedAnalyzer<double> local(csv_filename);
+  const srf::local::Parameters<double> local_parameters = local.parameters();
+  benchmark::measure(
+      "bnmr::srf", "local::DepthResolvedAnalyzer::operator()",
+      [&]() {
+        for (const double energy : energies) {
+          benchmark::do_not_optimize(local(energy, local_parameters));
+        }
+      },
+      energies.size());
+  benchmark::measure(
+      "bnmr::srf", "local::DepthResolvedAnalyzer::gauss_jacobi",
+      [&]() {
+        for (const double energy : energies) {
+          benchmark::do_not_optimize(
+              local.gauss_jacobi(energy, local_parameters));
+        }
+      },
+      energies.size());
+
+  // (the screening profile is cached by the warm-up call, i.e., this is the
+  // cost for fixed superconducting parameters, as when fitting the SLR ones)
+  srf::nonlocal::DepthResolvedAnalyzer<double> nonlocal(csv_filename);
+  nonlocal.set_field_profile_cache_capacity(64);
+  const srf::nonlocal::Parameters<double> nonlocal_parameters =
+      nonlocal.parameters();
+  benchmark::measure(
+      "bnmr::srf", "nonlocal::DepthResolvedAnalyzer::operator()",
+      [&]() {
+        for (const double energy : energies) {
+          benchmark::do_not_optimize(nonlocal(energy, nonlocal_parameters));
+        }
+      },
+      energies.size(), 3);
+  benchmark::measure(
+      "bnmr::srf", "nonlocal::DepthResolvedAnalyzer::gauss_jacobi",
+      [&]() {
+        for (const double energy : energies) {
+          benchmark::do_not_optimize(
+              nonlocal.gauss_jacobi(energy, nonlocal_parameters));
+        }
+      },
+      energies.size(), 3);
+  return 0;
+}
@@ -0,0 +1,103 @@
+// Cost of the "global" chi2 of a simultaneous fit of several pulsed SLR
+// datasets (with shared and local parameters), serially (global_chi2) and
+// concurrently (parallel_global_chi2), for a change of every parameter and
+// for a change of a single dataset's (local) parameter. Requires ROOT.
+
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+#include <Fit/BinData.h>
+#include <Fit/Chi2FCN.h>
+
+#include <triumf/bnmr/nuclei.hpp>
+#include <triumf/bnmr/slr/exp.hpp>
+#include <triumf/bnmr/slr/param_grad_function.hpp>
+#include <triumf/global_chi2.hpp>
+#include <triumf/numpy.hpp>
+
+#include "benchmark.hpp"
+
+int main() {
+  namespace slr = triumf::bnmr::slr;
+  typedef slr::ParamGradFunction<slr::PulsedExp<double>> Model;
+  // a temperature scan: 8 lithium-8 SLR spectra (16 s of data, in 10 ms bins)
+  // sharing the lifetime & pulse length, each with its own amplitude & rate
+  const std::size_t n_datasets = 8;
+  const double lifetime = triumf::bnmr::nuclei::lithium_8<double>::lifetime();
+  const double pulse_length = 4.0;
+  const std::vector<double> time =
+      triumf::numpy::linspace<double>(0.005, 15.995, 1600);
+
+  // global parameters: lifetime, pulse length, then (asymmetry, rate) pairs
+  std::vector<double> par = {lifetime, pulse_length};
+  std::vector<std::vector<int>> parameter_index;
+  std::vector<ROOT::Fit::BinData> data;
+  data.reserve(n_datasets);
+  for (std::size_t i = 0; i < n_datasets; ++i) {
+    const double local_par[] = {lifetime, pulse_length, 0.1,
+                                0.1 * (i + 1.0)};
+    std::vector<double> asymmetry(time.size());
+    std::vector<double> error(time.size());
+    for (std::size_t j = 0; j < time.size(); ++j) {
+      asymmetry[j] = slr::pulsed_exp<double>(&time[j], local_par);
+      error[j] = 0.01 * local_par[2];
+    }
+    data.emplace_back(time.size(), time.data(), asymmetry.data(), nullptr,
+                      error.data());
+    parameter_index.push_back({0, 1, static_cast<int>(par.size()),
+                               static_cast<int>(par.size() + 1)});
+    par.push_back(local_par[2]);
+    par.push_back(local_par[3]);
+  }
+  const Model model;
+  std::vector<ROOT::Fit::Chi2Function> chi2_functions;
+  chi2_functions.reserve(n_datasets);
+  for (const auto &d : data) {
+    chi2_functions.emplace_back(d, model);
+  }
+  std::vector<ROOT::Fit::Chi2Function *> chi2;
+  for (auto &c : chi2_functions) {
+    chi2.push_back(&c);
+  }
+
+  // (alternate between two values, such that the datasets are re-evaluated)
+  std::vector<double> par_changed = par;
+  par_changed[0] *= 1.0 + 1e-6;
+  std::vector<double> par_local = par;
+  par_local.back() *= 1.0 + 1e-6;
+
+  const triumf::global_chi2 serial(chi2, parameter_index);
+  benchmark::measure(
+      "global_chi2", "global_chi2 (all parameters)",
+      [&]() {
+        benchmark::do_not_optimize(serial(par.data()));
+        benchmark::do_not_optimize(serial(par_changed.data()));
+      },
+      2);
+  benchmark::measure(
+      "global_chi2", "global_chi2 (one local parameter)",
+      [&]() {
+        benchmark::do_not_optimize(serial(par.data()));
+        benchmark::do_not_optimize(serial(par_local.data()));
+      },
+      2);
+
+  const triumf::parallel_global_chi2 parallel(
+      chi2, parameter_index, std::thread::hardware_concurrency());
+  benchmark::measure(
+      "global_chi2", "parallel_global_chi2 (all parameters)",
+      [&]() {
+        benchmark::do_not_optimize(parallel(par.data()));
+        benchmark::do_not_optimize(parallel(par_changed.data()));
+      },
+      2);
+  benchmark::measure(
+      "global_chi2", "parallel_global_chi2 (one local parameter)",
+      [&]() {
+        benchmark::do_not_optimize(parallel(par.data()));
+        benchmark::do_not_optimize(parallel(par_local.data()));
+      },
+      2);
+  return 0;
+}
@@ -0,0 +1,64 @@
+// Per-point cost of the Faddeeva function w(z) over Voigt lineshape scans
+// (i.e., z = x + i y, for a fixed y & x spanning the line & its wings), by
+// the scalar & batch entry points, and of the scaled complementary error
+// function erfcx(x) for real x.
+
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <triumf/math/faddeeva.hpp>
+#include <triumf/numpy.hpp>
+
+#include "benchmark.hpp"
+
+int main() {
+  namespace faddeeva = triumf::math::faddeeva;
+  const std::size_t n = 20000;
+  const std::vector<double> x =
+      triumf::numpy::linspace<double>(-50.0, 50.0, n);
+  std::vector<std::complex<double>> z(n), w(n);
+  for (const double y : {0.01, 0.3, 3.0}) {
+    for (std::size_t i = 0; i < n; ++i) {
+      z[i] = std::complex<double>(x[i], y);
+    }
+    const std::string scan = " (y = " + std::to_string(y).substr(0, 4) + ")";
+    benchmark::measure(
+        "math::faddeeva", "w" + scan,
+        [&]() {
+          for (std::size_t i = 0; i < n; ++i) {
+            w[i] = faddeeva::w(z[i]);
+          }
+          benchmark::do_not_optimize(w[n / 2]);
+        },
+        n);
+    benchmark::measure(
+        "math::faddeeva", "w (batch)" + scan,
+        [&]() {
+          faddeeva::w(z.data(), n, w.data());
+          benchmark::do_not_optimize(w[n / 2]);
+        },
+        n);
+  }
+
+  std::vector<double> erfcx(n);
+  benchmark::measure(
+      "math::faddeeva", "erfcx",
+      [&]() {
+        for (std::size_t i = 0; i < n; ++i) {
+          erfcx[i] = faddeeva::erfcx(x[i]);
+        }
+        benchmark::do_not_optimize(erfcx[n / 2]);
+      },
+      n);
+  benchmark::measure(
+      "math::faddeeva", "erfcx (batch)",
+      [&]() {
+        faddeeva::erfcx(x.data(), n, erfcx.data());
+        benchmark::do_not_optimize(erfcx[n / 2]);
+      },
+      n);
+  return 0;
+}
@@ -0,0 +1,51 @@
+// Cost of the Hebel-Slichter SLR rate ratio, evaluated by adaptive quadrature
+// (slr_ratio) and with the fixed-node engine (SlrRatio), over a temperature
+// scan through the superconducting transition of niobium.
+
+#include <cstddef>
+#include <vector>
+
+#include <triumf/nmr/hebel_slichter.hpp>
+#include <triumf/numpy.hpp>
+#include <triumf/superconductivity/bcs.hpp>
+
+#include "benchmark.hpp"
+
+int main() {
+  namespace hebel_slichter = triumf::nmr::hebel_slichter;
+  // niobium: T_c (K) & Δ_0 (meV), with a modest Dynes broadening
+  const double critical_temperature = 9.25;
+  const double gap_meV =
+      triumf::superconductivity::bcs::gap_meV<double>(critical_temperature);
+  const double alpha = 0.001;
+  const double Gamma = 0.01;
+  const std::vector<double> temperatures =
+      triumf::numpy::linspace<double>(1.0, 12.0, 45);
+
+  benchmark::measure(
+      "nmr::hebel_slichter", "slr_ratio",
+      [&]() {
+        for (const double temperature : temperatures) {
+          benchmark::do_not_optimize(hebel_slichter::slr_ratio<double>(
+              temperature, critical_temperature, gap_meV, alpha, Gamma));
+        }
+      },
+      temperatures.size(), 3);
+
+  const hebel_slichter::SlrRatio<double> slr_ratio(critical_temperature,
+                                                   gap_meV, alpha, Gamma);
+  benchmark::measure(
+      "nmr::hebel_slichter", "SlrRatio::operator()",
+      [&]() {
+        for (const double temperature : temperatures) {
+          benchmark::do_not_optimize(slr_ratio(temperature));
+        }
+      },
+      temperatures.size());
+
+  benchmark::measure(
+      "nmr::hebel_slichter", "SlrRatio::operator() (batch)",
+      [&]() { benchmark::do_not_optimize(slr_ratio(temperatures)); },
+      temperatures.size());
+  return 0;
+}
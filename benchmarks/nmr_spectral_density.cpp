@@ -0,0 +1,74 @@
+// Per-point cost of the spectral density functions, in particular those
+// averaged over a distribution of correlation times (j_lg, j_ll, j_eb &
+// j_bm), and the BPP spectral density j_3d (for reference).
+
+#include <cmath>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <triumf/nmr/spectral_density.hpp>
+
+#include "benchmark.hpp"
+
+int main() {
+  using Model = triumf::nmr::SpectralDensity<double>::Model;
+  // correlation times spanning ω τ_c ~ 1e-6 to 1e6
+  const std::size_t n = 10000;
+  const double omega = 2.0 * 3.141592653589793 * 41.3e6;
+  std::vector<double> tau(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    tau[i] = std::pow(10.0, -6.0 + 12.0 * i / (n - 1)) / omega;
+  }
+  std::vector<double> j(n);
+  // (not known at compile time, as in a fit)
+  volatile double two = 2.0;
+  const double exponent = two;
+
+  // reference: the scalar BPP spectral density
+  benchmark::measure(
+      "nmr::spectral_density", "j_3d",
+      [&]() {
+        for (std::size_t i = 0; i < n; ++i) {
+          j[i] = triumf::nmr::j_3d<double>(tau[i], omega, 1.0, exponent);
+        }
+        benchmark::do_not_optimize(j[n / 2]);
+      },
+      n, 20);
+
+  const struct {
+    const char *name;
+    Model model;
+    double width;
+  } cases[] = {
+      {"j_3d (batch)", Model::j_3d, exponent},
+      {"j_lg (batch, width = 1)", Model::j_lg, 1.0},
+      {"j_lg (batch, width = 3)", Model::j_lg, 3.0},
+      {"j_ll (batch, width = 1)", Model::j_ll, 1.0},
+      {"j_eb (batch, width = 5)", Model::j_eb, 5.0},
+      {"j_bm (batch, epsilon = eta = 1)", Model::j_bm, 1.0},
+  };
+  for (const auto &c : cases) {
+    const triumf::nmr::SpectralDensity<double> density(c.model, 1.0, c.width);
+    benchmark::measure(
+        "nmr::spectral_density", c.name,
+        [&]() {
+          density(tau.data(), n, omega, j.data());
+          benchmark::do_not_optimize(j[n / 2]);
+        },
+        n, 20);
+  }
+
+  // the scalar distributions (which reuse the nodes while the width is
+  // unchanged)
+  benchmark::measure(
+      "nmr::spectral_density", "j_lg (width = 1)",
+      [&]() {
+        for (std::size_t i = 0; i < n; ++i) {
+          j[i] = triumf::nmr::j_lg<double>(tau[i], omega, 1.0, 1.0);
+        }
+        benchmark::do_not_optimize(j[n / 2]);
+      },
+      n, 20);
+  return 0;
+}
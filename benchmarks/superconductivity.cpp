@@ -0,0 +1,109 @@
+// Cost of the BCS & Pippard kernels and magnetic field penetration profiles,
+// for representative niobium parameters.
+
+#include <cstddef>
+#include <vector>
+
+#include <triumf/numpy.hpp>
+#include <triumf/superconductivity/bcs.hpp>
+#include <triumf/superconductivity/pippard.hpp>
+
+#include "benchmark.hpp"
+
+int main() {
+  namespace bcs = triumf::superconductivity::bcs;
+  namespace pippard = triumf::superconductivity::pippard;
+  // niobium: T (K), T_c (K), Δ_0 (meV), ξ_0 (nm), ℓ (nm), λ_0 (nm), n
+  const double temperature = 5.0;
+  const double critical_temperature = 9.25;
+  const double gap_meV = 1.5;
+  const double xi_0 = 40.0;
+  const double mean_free_path = 100.0;
+  const double lambda_0 = 30.0;
+  const double exponent = 4.0;
+  //
+  // wavevectors (1/nm) & depths (nm)
+  const std::vector<double> q =
+      triumf::numpy::logspace<double>(-3.0, 0.0, 100);
+  const std::vector<double> z =
+      triumf::numpy::linspace<double>(0.0, 200.0, 101);
+
+  benchmark::measure(
+      "superconductivity", "bcs::kernel",
+      [&]() {
+        for (const double q_i : q) {
+          benchmark::do_not_optimize(bcs::kernel<double>(
+              q_i, temperature, critical_temperature, gap_meV, xi_0,
+              mean_free_path, lambda_0, exponent));
+        }
+      },
+      q.size());
+
+  const bcs::KernelContext<double> context(temperature, critical_temperature,
+                                           gap_meV, xi_0, mean_free_path,
+                                           lambda_0, exponent);
+  benchmark::measure(
+      "superconductivity", "bcs::KernelContext::operator()",
+      [&]() {
+        for (const double q_i : q) {
+          benchmark::do_not_optimize(context(q_i));
+        }
+      },
+      q.size());
+
+  // (a few depths, as each evaluation is a Fourier integral over the kernel)
+  const std::vector<double> z_few = {10.0, 50.0, 100.0};
+  benchmark::measure(
+      "superconductivity", "bcs::reduced_field_penetration",
+      [&]() {
+        for (const double z_i : z_few) {
+          benchmark::do_not_optimize(bcs::reduced_field_penetration<double>(
+              z_i, temperature, critical_temperature, gap_meV, xi_0,
+              mean_free_path, lambda_0, exponent));
+        }
+      },
+      z_few.size());
+
+  benchmark::measure(
+      "superconductivity", "bcs::reduced_field_penetration (per depth, grid)",
+      [&]() {
+        benchmark::do_not_optimize(bcs::reduced_field_penetration<double>(
+            z, temperature, critical_temperature, gap_meV, xi_0,
+            mean_free_path, lambda_0, exponent));
+      },
+      z.size());
+
+  benchmark::measure(
+      "superconductivity", "pippard::kernel",
+      [&]() {
+        for (const double q_i : q) {
+          benchmark::do_not_optimize(pippard::kernel<double>(
+              q_i, temperature, critical_temperature, gap_meV, xi_0,
+              mean_free_path, lambda_0, exponent));
+        }
+      },
+      q.size());
+
+  benchmark::measure(
+      "superconductivity", "pippard::reduced_field_penetration",
+      [&]() {
+        for (const double z_i : z_few) {
+          benchmark::do_not_optimize(
+              pippard::reduced_field_penetration<double>(
+                  z_i, temperature, critical_temperature, gap_meV, xi_0,
+                  mean_free_path, lambda_0, exponent));
+        }
+      },
+      z_few.size());
+
+  benchmark::measure(
+      "superconductivity",
+      "pippard::reduced_field_penetration (per depth, grid)",
+      [&]() {
+        benchmark::do_not_optimize(pippard::reduced_field_penetration<double>(
+            z, temperature, critical_temperature, gap_meV, xi_0,
+            mean_free_path, lambda_0, exponent));
+      },
+      z.size());
+  return 0;
+}
@@ -32,27 +32,28 @@
 // function for interfacing w/ ROOT's fitting functions
 double slr_model(const double *x, const double *par) {
   // persistant instance of the depth-resolved analyzer
-  static triumf::bnmr::srf::local::DepthResolvedAnalyzer<double> dra(
+  static const triumf::bnmr::srf::local::DepthResolvedAnalyzer<double> dra(
       "srim_profile_8li_nb_fitpar.csv");
   // aliases for the independent variables
   double sample_temperature = x[0];
   double magnetic_field = x[1];
   double implantation_energy = x[2];
 
-  // set the model values
-  dra.temperature = sample_temperature;
-  dra.critical_temperature = par[0];
-  dra.lambda_0 = par[1];
-  dra.exponent = par[2];
-  dra.applied_field = magnetic_field;
-  dra.dipole_field = par[3];
-  dra.correlation_rate = par[4];
-  dra.slr_constant = par[5];
-  dra.slr_exponent = par[6];
-  dra.surface_thickness = par[7];
-  dra.surface_rate = par[8];
+  // set the model values (n.b., the analyzer itself is never modified)
+  triumf::bnmr::srf::local::Parameters<double> parameters;
+  parameters.temperature = sample_temperature;
+  parameters.critical_temperature = par[0];
+  parameters.lambda_0 = par[1];
+  parameters.exponent = par[2];
+  parameters.applied_field = magnetic_field;
+  parameters.dipole_field = par[3];
+  parameters.correlation_rate = par[4];
+  parameters.slr_constant = par[5];
+  parameters.slr_exponent = par[6];
+  parameters.surface_thickness = par[7];
+  parameters.surface_rate = par[8];
   //
-  return dra(implantation_energy);
+  return dra(implantation_energy, parameters);
 }
 
 void dumb_minimum_search() {
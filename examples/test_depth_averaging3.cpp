@@ -7,6 +7,7 @@
 #include <iostream>
 #include <limits>
 #include <numeric>
+#include <string>
 #include <vector>
 
 // triumf++ headers
@@ -49,34 +50,38 @@ const double SURFACE_RATE = 10.0;
 // function for interfacing w/ ROOT's fitting functions
 double slr_model(const double *x, const double *par) {
   // persistant instance of the depth-resolved analyzer
-  static triumf::bnmr::srf::nonlocal::DepthResolvedAnalyzer<double> dra(
+  static const triumf::bnmr::srf::nonlocal::DepthResolvedAnalyzer<double> dra(
       "srim_profile_8li_nb_fitpar.csv");
   // aliases for the independent variables
   double sample_temperature = x[0];
   double magnetic_field = x[1];
   double implantation_energy = x[2];
 
-  // set the model values
-  dra.temperature = sample_temperature;
-  dra.critical_temperature = par[0];
-  dra.gap_meV = par[1];
-  dra.xi_0 = par[2];
-  dra.mean_free_path = par[3];
-  dra.lambda_0 = par[4];
-  dra.exponent = par[5];
-  dra.applied_field = magnetic_field;
-  dra.dipole_field = par[6];
-  dra.correlation_rate = par[7];
-  dra.slr_constant = par[8];
-  dra.slr_exponent = par[9];
-  dra.surface_thickness = par[10];
-  dra.surface_rate = par[11];
-  dra.electron_phonon_coupling = par[12];
+  // set the model values (n.b., the analyzer itself is never modified, so this
+  // function can be called concurrently during a multithreaded fit)
+  triumf::bnmr::srf::nonlocal::Parameters<double> parameters;
+  parameters.temperature = sample_temperature;
+  parameters.critical_temperature = par[0];
+  parameters.gap_meV = par[1];
+  parameters.xi_0 = par[2];
+  parameters.mean_free_path = par[3];
+  parameters.lambda_0 = par[4];
+  parameters.exponent = par[5];
+  parameters.applied_field = magnetic_field;
+  parameters.dipole_field = par[6];
+  parameters.correlation_rate = par[7];
+  parameters.slr_constant = par[8];
+  parameters.slr_exponent = par[9];
+  parameters.surface_thickness = par[10];
+  parameters.surface_rate = par[11];
+  parameters.electron_phonon_coupling = par[12];
   //
-  return dra(implantation_energy);
+  return dra(implantation_energy, parameters);
 }
 
-void test_depth_averaging3() {
+// n.b., slr_model is reentrant, so the chi2 can also be evaluated
+// concurrently (i.e., with ROOT::Fit::ExecutionPolicy::kMultithread)
+void test_depth_averaging3(bool multithread = false) {
   //
   const double T_min = 0.0;
   const double T_max = 20.0;
@@ -339,8 +344,11 @@ void test_depth_averaging3() {
   // https://root-forum.cern.ch/t/minuit2-edm-question/18470
   fitter.Config().MinimizerOptions().SetTolerance(0.01);
 
-  fitter.Fit(data);
-  // fitter.Fit(data, ROOT::Fit::ExecutionPolicy::kMultithread);
+  if (multithread) {
+    fitter.Fit(data, ROOT::Fit::ExecutionPolicy::kMultithread);
+  } else {
+    fitter.Fit(data);
+  }
   const ROOT::Fit::FitResult &fit_result = fitter.Result();
   fit_result.Print(std::cout);
   f_3d->SetFitResult(fit_result);
@@ -357,8 +365,11 @@ void test_depth_averaging3() {
 }
 
 #ifndef __CLING__
-int main() {
-  test_depth_averaging3();
+int main(int argc, char *argv[]) {
+  // (pass --multithread to evaluate the chi2 concurrently)
+  const bool multithread =
+      argc > 1 and std::string(argv[1]) == "--multithread";
+  test_depth_averaging3(multithread);
   return EXIT_SUCCESS;
 }
 #endif
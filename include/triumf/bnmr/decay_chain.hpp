@@ -0,0 +1,460 @@
+#ifndef TRIUMF_BNMR_DECAY_CHAIN_HPP
+#define TRIUMF_BNMR_DECAY_CHAIN_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/math/constants/constants.hpp>
+
+#include <triumf/bnmr/nuclei.hpp>
+
+// TRIUMF: Canada's particle accelerator centre
+namespace triumf {
+
+// β-detected nuclear magnetic resonance (β-NMR)
+namespace bnmr {
+
+/// \brief Radioactive decay chain (i.e., the Bateman equations).
+/// \details A chain is a list of nuclides (each with a half-life, which is
+/// infinite for stable nuclides, and a relative detection efficiency) and
+/// the branches between them. Nuclides must be added such that parents
+/// precede their daughters, and the radioactive nuclides' decay constants
+/// must be distinct. Branching ratios from a parent need not add up to one
+/// (i.e., the remainder leaves the chain). The populations for pulsed beam
+/// loading are computed with Pulse (see pulse).
+template <typename T = double> class DecayChain {
+public:
+  /// member of the chain
+  struct Nuclide {
+    std::string name;
+    /// half-life (s)
+    T half_life;
+    /// relative detection efficiency
+    T efficiency;
+    /// decay constant (1/s)
+    T decay_constant() const {
+      return boost::math::constants::ln_two<T>() / half_life;
+    };
+  };
+
+  /// decay of a parent into a daughter
+  struct Branch {
+    std::size_t parent;
+    std::size_t daughter;
+    T ratio;
+  };
+
+  /// \brief Populations of a chain for pulsed beam loading.
+  /// \details The beam implants one of the nuclides at a constant rate for
+  /// 0 < t <= beam_pulse, after which the chain decays freely. In both
+  /// phases, the solution of the rate equations is of the form
+  ///
+  ///   n_i(t) = alpha_i + beta_i t + sum_k gamma_ik exp(-lambda_k t),
+  ///
+  /// where k runs over the radioactive nuclides (beta_i is non-zero only for
+  /// stable nuclides during the pulse). The coefficients follow from a
+  /// recurrence over the chain (parents first), which is evaluated once,
+  /// upon construction, for the numbers, the activities, and their totals.
+  /// Each time then costs one exponential per radioactive nuclide, which
+  /// are shared by all of the quantities evaluated at that time. During the
+  /// pulse, 1 - exp(-lambda_k t) is used instead (i.e., expm1), such that
+  /// the populations are accurate at early times.
+  class Pulse {
+  public:
+    /// constructor.
+    Pulse(const DecayChain &chain, T beam_pulse, T beam_rate,
+          std::size_t beam)
+        : _n(chain.size()), _beam(beam), _beam_pulse(beam_pulse),
+          _beam_rate(beam_rate),
+          _detected(chain.nuclide(beam).efficiency > 0.0) {
+      if (not(beam_pulse > 0.0)) {
+        throw std::domain_error(
+            "triumf::bnmr::DecayChain::Pulse: invalid beam pulse");
+      }
+      // decay constants, and the radioactive nuclides' basis functions
+      std::vector<T> lambda(_n);
+      std::vector<std::size_t> column(_n, 0);
+      for (std::size_t i = 0; i < _n; ++i) {
+        lambda[i] = chain.nuclide(i).decay_constant();
+        if (lambda[i] > 0.0) {
+          for (const T l : _lambda) {
+            if (l == lambda[i]) {
+              throw std::domain_error("triumf::bnmr::DecayChain::Pulse: "
+                                      "degenerate decay constants");
+            }
+          }
+          column[i] = _lambda.size();
+          _lambda.push_back(lambda[i]);
+        }
+      }
+      const std::size_t m = _lambda.size();
+      // during the pulse (from empty)
+      std::vector<T> rate(_n, 0.0);
+      rate[beam] = beam_rate;
+      std::vector<T> empty(_n, 0.0);
+      Solution pulse = solve(chain, lambda, column, rate, empty);
+      // in terms of 1 - exp(-lambda_k t) during the pulse (i.e., the
+      // constant term is the (empty) initial population)
+      for (std::size_t i = 0; i < _n; ++i) {
+        pulse.alpha[i] = empty[i];
+        for (std::size_t k = 0; k < m; ++k) {
+          pulse.gamma[i * m + k] = -pulse.gamma[i * m + k];
+        }
+      }
+      // populations at the end of the pulse
+      std::vector<T> n_end(_n);
+      for (std::size_t i = 0; i < _n; ++i) {
+        n_end[i] = pulse.alpha[i] + pulse.beta[i] * beam_pulse;
+        for (std::size_t k = 0; k < m; ++k) {
+          n_end[i] +=
+              pulse.gamma[i * m + k] * -std::expm1(-_lambda[k] * beam_pulse);
+        }
+      }
+      // after the pulse (free decay from the end of the pulse)
+      std::vector<T> zero(_n, 0.0);
+      Solution decay = solve(chain, lambda, column, zero, n_end);
+      // tabulate the rows: numbers, activities, and their totals
+      std::vector<T> efficiency(_n);
+      for (std::size_t i = 0; i < _n; ++i) {
+        efficiency[i] = chain.nuclide(i).efficiency * lambda[i];
+      }
+      _pulse = tabulate(pulse, efficiency);
+      _decay = tabulate(decay, efficiency);
+    };
+
+    /// Return the number of atoms of nuclide i at a given time.
+    T number(std::size_t i, T time) const {
+      return evaluate(row(i), time);
+    };
+
+    /// Return the (detected) activity of nuclide i at a given time (i.e.,
+    /// efficiency * decay constant * number).
+    T activity(std::size_t i, T time) const {
+      return evaluate(row(_n + i), time);
+    };
+
+    /// Return the total number of atoms at a given time.
+    T total_number(T time) const { return evaluate(row(2 * _n), time); };
+
+    /// Return the total (detected) activity at a given time.
+    T total_activity(T time) const {
+      return evaluate(row(2 * _n + 1), time);
+    };
+
+    /// Return the fraction of the atoms that are nuclide i at a given time
+    /// (for time <= 0, the limit time -> 0+ is returned).
+    T number_fraction(std::size_t i, T time) const {
+      if (not(time > 0.0)) {
+        return i == _beam ? 1.0 : 0.0;
+      }
+      return ratio(row(i), row(2 * _n), time);
+    };
+
+    /// Return the fraction of the detected activity due to nuclide i at a
+    /// given time (for time <= 0, the limit time -> 0+ is returned; once the
+    /// whole chain has decayed, i.e., the total activity underflows, the
+    /// fraction is undefined).
+    T detected_fraction(std::size_t i, T time) const {
+      if (not(time > 0.0)) {
+        return i == _beam and _detected ? 1.0 : 0.0;
+      }
+      return ratio(row(_n + i), row(2 * _n + 1), time);
+    };
+
+    /// Evaluate the number of atoms of nuclide i at each time.
+    void number(std::size_t i, const std::vector<T> &time,
+                std::vector<T> &result) const {
+      apply(time, result, [&](T t) { return number(i, t); });
+    };
+
+    /// Evaluate the (detected) activity of nuclide i at each time.
+    void activity(std::size_t i, const std::vector<T> &time,
+                  std::vector<T> &result) const {
+      apply(time, result, [&](T t) { return activity(i, t); });
+    };
+
+    /// Evaluate the fraction of the atoms that are nuclide i at each time.
+    void number_fraction(std::size_t i, const std::vector<T> &time,
+                         std::vector<T> &result) const {
+      apply(time, result, [&](T t) { return number_fraction(i, t); });
+    };
+
+    /// Evaluate the fraction of the detected activity due to nuclide i at
+    /// each time.
+    void detected_fraction(std::size_t i, const std::vector<T> &time,
+                           std::vector<T> &result) const {
+      apply(time, result, [&](T t) { return detected_fraction(i, t); });
+    };
+
+    /// Return the beam pulse length (s).
+    T beam_pulse() const { return _beam_pulse; };
+
+    /// Return the beam rate (1/s).
+    T beam_rate() const { return _beam_rate; };
+
+  private:
+    /// coefficients of the solution (gamma is n x m, row major)
+    struct Solution {
+      std::vector<T> alpha;
+      std::vector<T> beta;
+      std::vector<T> gamma;
+    };
+
+    /// \brief Solve the rate equations for constant production rates and
+    /// initial populations.
+    /// \details Substituting the form of the solution into
+    ///
+    ///   dn_i/dt = rate_i - lambda_i n_i + sum_p b_pi lambda_p n_p
+    ///
+    /// and matching terms gives, for each nuclide (parents first),
+    ///
+    ///   gamma_ik = sum_p b_pi lambda_p gamma_pk / (lambda_i - lambda_k),
+    ///
+    /// for k != i. Radioactive nuclides have beta_i = 0 and
+    /// alpha_i = (rate_i + sum_p b_pi lambda_p alpha_p) / lambda_i, while
+    /// stable nuclides have beta_i = rate_i + sum_p b_pi lambda_p alpha_p.
+    /// The remaining coefficient (gamma_ii or alpha_i, respectively) is set
+    /// by the initial population.
+    Solution solve(const DecayChain &chain, const std::vector<T> &lambda,
+                   const std::vector<std::size_t> &column,
+                   const std::vector<T> &rate,
+                   const std::vector<T> &initial) const {
+      const std::size_t m = _lambda.size();
+      Solution s = {std::vector<T>(_n, 0.0), std::vector<T>(_n, 0.0),
+                    std::vector<T>(_n * m, 0.0)};
+      for (std::size_t i = 0; i < _n; ++i) {
+        // feeding from the parents
+        T feed = rate[i];
+        std::vector<T> feed_gamma(m, 0.0);
+        for (const Branch &branch : chain.branches()) {
+          if (branch.daughter == i) {
+            const std::size_t p = branch.parent;
+            const T b = branch.ratio * lambda[p];
+            feed += b * s.alpha[p];
+            for (std::size_t k = 0; k < m; ++k) {
+              feed_gamma[k] += b * s.gamma[p * m + k];
+            }
+          }
+        }
+        const bool radioactive = lambda[i] > 0.0;
+        T sum = 0.0;
+        for (std::size_t k = 0; k < m; ++k) {
+          if (not(radioactive and k == column[i])) {
+            s.gamma[i * m + k] = feed_gamma[k] / (lambda[i] - _lambda[k]);
+            sum += s.gamma[i * m + k];
+          }
+        }
+        if (radioactive) {
+          s.alpha[i] = feed / lambda[i];
+          s.gamma[i * m + column[i]] = initial[i] - s.alpha[i] - sum;
+        } else {
+          s.beta[i] = feed;
+          s.alpha[i] = initial[i] - sum;
+        }
+      }
+      return s;
+    };
+
+    /// rows of coefficients for the basis {1, t, x_0, ..., x_{m - 1}}:
+    /// numbers, activities, total number, and total activity
+    std::vector<T> tabulate(const Solution &s,
+                            const std::vector<T> &efficiency) const {
+      const std::size_t m = _lambda.size();
+      const std::size_t w = m + 2;
+      std::vector<T> table((2 * _n + 2) * w, 0.0);
+      for (std::size_t i = 0; i < _n; ++i) {
+        T *number = table.data() + i * w;
+        number[0] = s.alpha[i];
+        number[1] = s.beta[i];
+        for (std::size_t k = 0; k < m; ++k) {
+          number[2 + k] = s.gamma[i * m + k];
+        }
+        T *activity = table.data() + (_n + i) * w;
+        T *total_number = table.data() + 2 * _n * w;
+        T *total_activity = table.data() + (2 * _n + 1) * w;
+        for (std::size_t j = 0; j < w; ++j) {
+          activity[j] = efficiency[i] * number[j];
+          total_number[j] += number[j];
+          total_activity[j] += activity[j];
+        }
+      }
+      return table;
+    };
+
+    /// offset of a row in the tables
+    std::size_t row(std::size_t r) const { return r * (_lambda.size() + 2); };
+
+    /// Accumulate the rows (at offsets a & b) for a given time (with
+    /// shared exponentials).
+    void accumulate(std::size_t a, std::size_t b, T time, T &sum_a,
+                    T &sum_b) const {
+      const bool pulsed = time <= _beam_pulse;
+      const T *table = pulsed ? _pulse.data() : _decay.data();
+      const T t = pulsed ? time : time - _beam_pulse;
+      sum_a = table[a] + table[a + 1] * t;
+      sum_b = table[b] + table[b + 1] * t;
+      for (std::size_t k = 0; k < _lambda.size(); ++k) {
+        const T x = pulsed ? -std::expm1(-_lambda[k] * t)
+                           : std::exp(-_lambda[k] * t);
+        sum_a += table[a + 2 + k] * x;
+        sum_b += table[b + 2 + k] * x;
+      }
+    };
+
+    /// row (at offset a) at a given time
+    T evaluate(std::size_t a, T time) const {
+      if (not(time > 0.0)) {
+        return 0.0;
+      }
+      T sum_a, sum_b;
+      accumulate(a, a, time, sum_a, sum_b);
+      return sum_a;
+    };
+
+    /// ratio of the rows (at offsets a & b) at a given (positive) time
+    T ratio(std::size_t a, std::size_t b, T time) const {
+      T sum_a, sum_b;
+      accumulate(a, b, time, sum_a, sum_b);
+      return sum_a / sum_b;
+    };
+
+    /// Evaluate f at each time.
+    template <typename F>
+    static void apply(const std::vector<T> &time, std::vector<T> &result,
+                      F f) {
+      result.resize(time.size());
+      for (std::size_t i = 0; i < time.size(); ++i) {
+        result[i] = f(time[i]);
+      }
+    };
+
+    /// number of nuclides
+    std::size_t _n;
+    /// implanted nuclide
+    std::size_t _beam;
+    /// beam pulse length (s) & rate (1/s)
+    T _beam_pulse;
+    T _beam_rate;
+    /// whether the implanted nuclide is detected at all
+    bool _detected;
+    /// decay constants of the radioactive nuclides (1/s)
+    std::vector<T> _lambda;
+    /// coefficient tables during & after the pulse
+    std::vector<T> _pulse;
+    std::vector<T> _decay;
+  };
+
+  /// constructor.
+  DecayChain(){};
+
+  /// Add a nuclide (with half-life in s, infinite if stable) to the chain,
+  /// and return its index.
+  std::size_t add_nuclide(const std::string &name, T half_life,
+                          T efficiency = 1.0) {
+    if (not(half_life > 0.0) or not(efficiency >= 0.0)) {
+      throw std::domain_error(
+          "triumf::bnmr::DecayChain: invalid nuclide " + name);
+    }
+    _nuclides.push_back({name, half_life, efficiency});
+    return _nuclides.size() - 1;
+  };
+
+  /// Add a branch (with a given branching ratio) from a parent to one of its
+  /// daughters, both of which must already be in the chain.
+  void add_branch(std::size_t parent, std::size_t daughter, T ratio) {
+    if (not(parent < daughter and daughter < _nuclides.size())) {
+      throw std::invalid_argument(
+          "triumf::bnmr::DecayChain: parents must precede their daughters");
+    }
+    if (not(ratio >= 0.0 and ratio <= 1.0) or
+        not(_nuclides[parent].decay_constant() > 0.0)) {
+      throw std::domain_error("triumf::bnmr::DecayChain: invalid branch");
+    }
+    _branches.push_back({parent, daughter, ratio});
+  };
+
+  /// Add a branch between two nuclides (by name).
+  void add_branch(const std::string &parent, const std::string &daughter,
+                  T ratio) {
+    add_branch(index(parent), index(daughter), ratio);
+  };
+
+  /// Return the index of a nuclide (by name).
+  std::size_t index(const std::string &name) const {
+    for (std::size_t i = 0; i < _nuclides.size(); ++i) {
+      if (_nuclides[i].name == name) {
+        return i;
+      }
+    }
+    throw std::invalid_argument("triumf::bnmr::DecayChain: unknown nuclide " +
+                                name);
+  };
+
+  /// Return the number of nuclides.
+  std::size_t size() const { return _nuclides.size(); };
+
+  /// Return a nuclide.
+  const Nuclide &nuclide(std::size_t i) const { return _nuclides.at(i); };
+
+  /// Return the branches.
+  const std::vector<Branch> &branches() const { return _branches; };
+
+  /// Return the populations for a beam of nuclide beam (by default, the
+  /// first one), with a given pulse length (s) and rate (1/s).
+  Pulse pulse(T beam_pulse, T beam_rate = 1.0, std::size_t beam = 0) const {
+    return Pulse(*this, beam_pulse, beam_rate, beam);
+  };
+
+private:
+  /// members of the chain
+  std::vector<Nuclide> _nuclides;
+  /// decays between them
+  std::vector<Branch> _branches;
+};
+
+// decay chains of the β-NMR probe nuclei (with the probe first)
+namespace decay_chains {
+
+/// lithium-8 (the beryllium-8 daughter breaks up into two α particles)
+template <typename T = double> DecayChain<T> lithium_8() {
+  DecayChain<T> chain;
+  chain.add_nuclide("8Li", nuclei::lithium_8<T>::half_life());
+  chain.add_nuclide("8Be", std::numeric_limits<T>::infinity(), 0.0);
+  chain.add_branch(0, 1, 1.0);
+  return chain;
+}
+
+/// beryllium-11 (including the β-delayed α branch)
+template <typename T = double> DecayChain<T> beryllium_11() {
+  DecayChain<T> chain;
+  chain.add_nuclide("11Be", nuclei::beryllium_11<T>::half_life());
+  chain.add_nuclide("11B", std::numeric_limits<T>::infinity(), 0.0);
+  chain.add_nuclide("7Li", std::numeric_limits<T>::infinity(), 0.0);
+  chain.add_branch(0, 1, 0.967);
+  chain.add_branch(0, 2, 0.033);
+  return chain;
+}
+
+/// boron-12 (including the β-delayed α branch, whose three α particles are
+/// counted as a single helium-4 atom per decay)
+template <typename T = double> DecayChain<T> boron_12() {
+  DecayChain<T> chain;
+  chain.add_nuclide("12B", nuclei::boron_12<T>::half_life());
+  chain.add_nuclide("12C", std::numeric_limits<T>::infinity(), 0.0);
+  chain.add_nuclide("4He", std::numeric_limits<T>::infinity(), 0.0);
+  chain.add_branch(0, 1, 0.984);
+  chain.add_branch(0, 2, 0.016);
+  return chain;
+}
+
+} // namespace decay_chains
+
+} // namespace bnmr
+
+} // namespace triumf
+
+#endif // TRIUMF_BNMR_DECAY_CHAIN_HPP
@@ -0,0 +1,212 @@
+#ifndef TRIUMF_BNMR_RESONANCE_LINESHAPE_HPP
+#define TRIUMF_BNMR_RESONANCE_LINESHAPE_HPP
+
+// C++ standard library headers
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+
+// Boost headers
+#include <boost/math/constants/constants.hpp>
+
+// triumf++ headers
+#include <triumf/math/faddeeva.hpp>
+
+// TRIUMF: Canada's particle accelerator centre
+namespace triumf {
+
+// β-detected nuclear magnetic resonance (β-NMR)
+namespace bnmr {
+
+// resonance spectra (i.e., the asymmetry as a function of frequency)
+namespace resonance {
+
+/// Lorentzian lineshape (of unit area), with half width at half maximum hwhm
+template <typename T = double> T lorentzian(T frequency, T position, T hwhm) {
+  const T detuning = frequency - position;
+  return hwhm / (boost::math::constants::pi<T>() *
+                 (detuning * detuning + hwhm * hwhm));
+}
+
+/// Gaussian lineshape (of unit area), with standard deviation sigma
+template <typename T = double> T gaussian(T frequency, T position, T sigma) {
+  const T x = (frequency - position) / sigma;
+  return std::exp(-0.5 * x * x) /
+         (boost::math::constants::root_two_pi<T>() * sigma);
+}
+
+/// \brief Voigt lineshape (of unit area).
+/// \details The convolution of a Gaussian (with standard deviation sigma) and
+/// a Lorentzian (with half width at half maximum hwhm), i.e.,
+/// Re[w(z)] / (σ √(2π)), where z = (ν - ν_0 + i hwhm) / (σ √2) and w is the
+/// Faddeeva function (evaluated in double precision).
+template <typename T = double>
+T voigt(T frequency, T position, T sigma, T hwhm) {
+  const T s = boost::math::constants::root_two<T>() * sigma;
+  const std::complex<double> z(static_cast<double>((frequency - position) / s),
+                               static_cast<double>(hwhm / s));
+  return static_cast<T>(std::real(triumf::math::faddeeva::w(z))) /
+         (boost::math::constants::root_pi<T>() * s);
+}
+
+/// \brief pseudo-Voigt lineshape (of unit area).
+/// \details The mixture η L + (1 - η) G of a Lorentzian and a Gaussian with
+/// the same full width at half maximum (fwhm).
+template <typename T = double>
+T pseudo_voigt(T frequency, T position, T fwhm, T eta) {
+  // FWHM of a Gaussian in units of its standard deviation, 2 √(2 ln(2))
+  const T fwhm_sigma = 2.0 * boost::math::constants::root_ln_four<T>();
+  return eta * lorentzian<T>(frequency, position, 0.5 * fwhm) +
+         (1.0 - eta) * gaussian<T>(frequency, position, fwhm / fwhm_sigma);
+}
+
+// The lineshapes for many detunings (i.e., frequency - position) at once. Each
+// provides the number of its shape parameters (par) and:
+//
+//   static void evaluate(const T *detuning, std::size_t n, const T *par,
+//                        T *value, T *derivative = nullptr);
+//
+// which evaluates the lineshape at the n detunings into value and, unless
+// derivative is null, its derivatives with respect to the detuning (into
+// derivative[i]) and to each shape parameter par[k] (into
+// derivative[(k + 1) * n + i]).
+
+/// Lorentzian lineshape (par = {hwhm}; see lorentzian)
+template <typename T = double> struct Lorentzian {
+  /// number of shape parameters
+  static constexpr unsigned int n_parameters = 1;
+
+  /// Evaluate the lineshape (and its derivatives) at each detuning.
+  static void evaluate(const T *detuning, std::size_t n, const T *par,
+                       T *value, T *derivative = nullptr) {
+    const T hwhm = par[0];
+    const T hwhm_squared = hwhm * hwhm;
+    const T scale = hwhm / boost::math::constants::pi<T>();
+    for (std::size_t i = 0; i < n; ++i) {
+      const T inverse = 1.0 / (detuning[i] * detuning[i] + hwhm_squared);
+      value[i] = scale * inverse;
+      if (derivative != nullptr) {
+        derivative[i] = -2.0 * detuning[i] * inverse * value[i];
+        derivative[n + i] = value[i] * (1.0 / hwhm - 2.0 * hwhm * inverse);
+      }
+    }
+  };
+};
+
+/// Gaussian lineshape (par = {sigma}; see gaussian)
+template <typename T = double> struct Gaussian {
+  /// number of shape parameters
+  static constexpr unsigned int n_parameters = 1;
+
+  /// Evaluate the lineshape (and its derivatives) at each detuning.
+  static void evaluate(const T *detuning, std::size_t n, const T *par,
+                       T *value, T *derivative = nullptr) {
+    const T sigma = par[0];
+    const T inverse_variance = 1.0 / (sigma * sigma);
+    const T scale = 1.0 / (boost::math::constants::root_two_pi<T>() * sigma);
+    for (std::size_t i = 0; i < n; ++i) {
+      const T x_squared = detuning[i] * detuning[i] * inverse_variance;
+      value[i] = scale * std::exp(-0.5 * x_squared);
+      if (derivative != nullptr) {
+        derivative[i] = -detuning[i] * inverse_variance * value[i];
+        derivative[n + i] = value[i] * (x_squared - 1.0) / sigma;
+      }
+    }
+  };
+};
+
+/// \brief Voigt lineshape (par = {sigma, hwhm}; see voigt).
+/// \details The Faddeeva function is evaluated (in double precision) by the
+/// batch faddeeva::w, in blocks of block_size detunings (on the stack), and
+/// its derivative follows from w'(z) = -2 z w(z) + 2 i / √π.
+template <typename T = double> struct Voigt {
+  /// number of shape parameters
+  static constexpr unsigned int n_parameters = 2;
+
+  /// number of detunings per call of faddeeva::w
+  static constexpr std::size_t block_size = 256;
+
+  /// Evaluate the lineshape (and its derivatives) at each detuning.
+  static void evaluate(const T *detuning, std::size_t n, const T *par,
+                       T *value, T *derivative = nullptr) {
+    const T sigma = par[0];
+    const T hwhm = par[1];
+    const T s = boost::math::constants::root_two<T>() * sigma;
+    const T scale = 1.0 / (boost::math::constants::root_pi<T>() * s);
+    const double y = static_cast<double>(hwhm / s);
+    const double two_over_root_pi =
+        boost::math::constants::two_div_root_pi<double>();
+    std::complex<double> z[block_size];
+    std::complex<double> w[block_size];
+    for (std::size_t i0 = 0; i0 < n; i0 += block_size) {
+      const std::size_t m = std::min(block_size, n - i0);
+      for (std::size_t i = 0; i < m; ++i) {
+        z[i] = std::complex<double>(static_cast<double>(detuning[i0 + i] / s),
+                                    y);
+      }
+      triumf::math::faddeeva::w(z, m, w);
+      for (std::size_t i = 0; i < m; ++i) {
+        value[i0 + i] = scale * static_cast<T>(std::real(w[i]));
+      }
+      if (derivative != nullptr) {
+        for (std::size_t i = 0; i < m; ++i) {
+          // w'(z)
+          const std::complex<double> dw =
+              -2.0 * z[i] * w[i] + std::complex<double>(0.0, two_over_root_pi);
+          derivative[i0 + i] = scale * static_cast<T>(std::real(dw)) / s;
+          derivative[n + i0 + i] =
+              -(scale * static_cast<T>(std::real(dw * z[i])) + value[i0 + i]) /
+              sigma;
+          derivative[2 * n + i0 + i] =
+              -scale * static_cast<T>(std::imag(dw)) / s;
+        }
+      }
+    }
+  };
+};
+
+/// pseudo-Voigt lineshape (par = {fwhm, eta}; see pseudo_voigt)
+template <typename T = double> struct PseudoVoigt {
+  /// number of shape parameters
+  static constexpr unsigned int n_parameters = 2;
+
+  /// Evaluate the lineshape (and its derivatives) at each detuning.
+  static void evaluate(const T *detuning, std::size_t n, const T *par,
+                       T *value, T *derivative = nullptr) {
+    const T fwhm = par[0];
+    const T eta = par[1];
+    const T fwhm_sigma = 2.0 * boost::math::constants::root_ln_four<T>();
+    const T hwhm_squared = 0.25 * fwhm * fwhm;
+    const T inverse_variance = fwhm_sigma * fwhm_sigma / (fwhm * fwhm);
+    const T lorentzian_scale = 0.5 * fwhm / boost::math::constants::pi<T>();
+    const T gaussian_scale =
+        fwhm_sigma / (boost::math::constants::root_two_pi<T>() * fwhm);
+    for (std::size_t i = 0; i < n; ++i) {
+      const T x_squared = detuning[i] * detuning[i];
+      const T inverse = 1.0 / (x_squared + hwhm_squared);
+      const T l = lorentzian_scale * inverse;
+      const T g =
+          gaussian_scale * std::exp(-0.5 * x_squared * inverse_variance);
+      value[i] = eta * l + (1.0 - eta) * g;
+      if (derivative != nullptr) {
+        derivative[i] = eta * (-2.0 * detuning[i] * inverse * l) +
+                        (1.0 - eta) * (-detuning[i] * inverse_variance * g);
+        // (both widths are proportional to the FWHM)
+        derivative[n + i] =
+            (eta * l * (1.0 - 2.0 * hwhm_squared * inverse) +
+             (1.0 - eta) * g * (x_squared * inverse_variance - 1.0)) /
+            fwhm;
+        derivative[2 * n + i] = l - g;
+      }
+    }
+  };
+};
+
+} // namespace resonance
+
+} // namespace bnmr
+
+} // namespace triumf
+
+#endif // TRIUMF_BNMR_RESONANCE_LINESHAPE_HPP
@@ -0,0 +1,295 @@
+#ifndef TRIUMF_BNMR_RESONANCE_SPECTRUM_HPP
+#define TRIUMF_BNMR_RESONANCE_SPECTRUM_HPP
+
+// C++ standard library headers
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <vector>
+
+// triumf++ headers
+#include <triumf/bnmr/nuclei.hpp>
+#include <triumf/bnmr/resonance/lineshape.hpp>
+#include <triumf/constants/codata_2018.hpp>
+
+// TRIUMF: Canada's particle accelerator centre
+namespace triumf {
+
+// β-detected nuclear magnetic resonance (β-NMR)
+namespace bnmr {
+
+// resonance spectra (i.e., the asymmetry as a function of frequency)
+namespace resonance {
+
+/// \brief Quadrupole frequency (Hz) of a nucleus (see nuclei) in an electric
+/// field gradient efg (V m^-2).
+/// \details ν_q = 3 e Q V_zz / (2 I (2 I - 1) h), such that (to first order)
+/// adjacent lines of the quadrupole-split spectrum are separated by
+/// ν_q (3 cos^2(θ) - 1) / 2, where θ is the angle between the applied field
+/// and the principal axis of the (axially symmetric) electric field gradient.
+template <template <typename> class Nucleus, typename T = double>
+T quadrupole_frequency(T efg) {
+  static_assert(Nucleus<T>::spin() > 0.5,
+                "nuclei with spin 1/2 have no quadrupole moment");
+  const T spin = Nucleus<T>::spin();
+  // e / h (Hz V^-1) & Q (b -> m^2)
+  return triumf::constants::codata_2018::elementary_charge<T>::value() /
+         triumf::constants::codata_2018::Planck_constant<T>::value() *
+         Nucleus<T>::electric_quadrupole_moment() * 1e-28 * 3.0 * efg /
+         (2.0 * spin * (2.0 * spin - 1.0));
+}
+
+/// \brief A single resonance (of the asymmetry), for many frequencies at once.
+/// \details The (ROOT) parameters are par = {baseline, position, amplitude,
+/// shape...}, where shape are the parameters of the Lineshape (e.g., Voigt),
+/// and the asymmetry is baseline - amplitude * lineshape(frequency - position)
+/// (i.e., the amplitude is the area of the line).
+template <template <typename> class Lineshape, typename T = double>
+class Resonance {
+public:
+  /// number of the lineshape's (shape) parameters
+  static constexpr unsigned int n_shape_parameters =
+      Lineshape<T>::n_parameters;
+
+  /// number of (ROOT) parameters
+  static constexpr unsigned int n_parameters = 3 + n_shape_parameters;
+
+  /// number of frequencies evaluated together (on the stack)
+  static constexpr std::size_t block_size = 256;
+
+  /// constructor.
+  Resonance(T baseline, T position, T amplitude,
+            const std::array<T, n_shape_parameters> &shape)
+      : _parameters{baseline, position, amplitude} {
+    std::copy(shape.begin(), shape.end(), _parameters.begin() + 3);
+  };
+
+  /// constructor (from the ROOT parameters).
+  explicit Resonance(const T *par) {
+    std::copy(par, par + n_parameters, _parameters.begin());
+  };
+
+  /// Return the asymmetry at a given frequency.
+  T operator()(T frequency) const {
+    T result;
+    evaluate(&frequency, 1, &result);
+    return result;
+  };
+
+  /// Return the asymmetry at a given frequency, and set gradient to its
+  /// derivatives with respect to the (ROOT) parameters.
+  T operator()(T frequency, T *gradient) const {
+    T result;
+    evaluate(&frequency, 1, &result, gradient);
+    return result;
+  };
+
+  /// Evaluate the asymmetry at n frequencies and, unless gradient is null,
+  /// its derivatives with respect to the (ROOT) parameters (into
+  /// gradient[i * n_parameters + j]).
+  void evaluate(const T *frequency, std::size_t n, T *result,
+                T *gradient = nullptr) const {
+    const T baseline = _parameters[0];
+    const T position = _parameters[1];
+    const T amplitude = _parameters[2];
+    const T *shape = _parameters.data() + 3;
+    T detuning[block_size];
+    T value[block_size];
+    T derivative[(1 + n_shape_parameters) * block_size];
+    for (std::size_t i0 = 0; i0 < n; i0 += block_size) {
+      const std::size_t m = std::min(block_size, n - i0);
+      for (std::size_t i = 0; i < m; ++i) {
+        detuning[i] = frequency[i0 + i] - position;
+      }
+      Lineshape<T>::evaluate(detuning, m, shape, value,
+                             gradient != nullptr ? derivative : nullptr);
+      for (std::size_t i = 0; i < m; ++i) {
+        result[i0 + i] = baseline - amplitude * value[i];
+      }
+      if (gradient != nullptr) {
+        for (std::size_t i = 0; i < m; ++i) {
+          T *g = gradient + (i0 + i) * n_parameters;
+          g[0] = 1.0;
+          g[1] = amplitude * derivative[i];
+          g[2] = -value[i];
+          for (unsigned int k = 0; k < n_shape_parameters; ++k) {
+            g[3 + k] = -amplitude * derivative[(k + 1) * m + i];
+          }
+        }
+      }
+    }
+  };
+
+  /// Evaluate the asymmetry at each frequency.
+  void evaluate(const std::vector<T> &frequency,
+                std::vector<T> &result) const {
+    result.resize(frequency.size());
+    evaluate(frequency.data(), frequency.size(), result.data());
+  };
+
+  /// Evaluate the asymmetry, and its gradient (n_parameters per frequency),
+  /// at each frequency.
+  void evaluate(const std::vector<T> &frequency, std::vector<T> &result,
+                std::vector<T> &gradient) const {
+    result.resize(frequency.size());
+    gradient.resize(frequency.size() * n_parameters);
+    evaluate(frequency.data(), frequency.size(), result.data(),
+             gradient.data());
+  };
+
+private:
+  /// model parameters
+  std::array<T, n_parameters> _parameters;
+};
+
+/// \brief A (first-order) quadrupole-split resonance of a nucleus (see
+/// nuclei), for many frequencies at once.
+/// \details The 2I lines (i.e., the m <-> m - 1 transitions, where
+/// m = I, I - 1, ..., -I + 1) share the same Lineshape (e.g., Voigt), and are
+/// centred at larmor_frequency - quadrupole_splitting * (m - 1/2), where the
+/// quadrupole_splitting is the separation of adjacent lines (see
+/// quadrupole_frequency). The (ROOT) parameters are par = {baseline,
+/// larmor_frequency, quadrupole_splitting, shape..., amplitudes...}, with the
+/// amplitudes (i.e., the areas) of the lines ordered by descending m, and the
+/// asymmetry is baseline - Σ amplitude * lineshape(frequency - centre).
+template <template <typename> class Lineshape,
+          template <typename> class Nucleus, typename T = double>
+class QuadrupoleSplitResonance {
+public:
+  /// number of lines (2I)
+  static constexpr unsigned int n_lines =
+      static_cast<unsigned int>(2.0 * Nucleus<T>::spin() + 0.5);
+
+  static_assert(n_lines > 1, "nuclei with spin 1/2 have a single line");
+
+  /// number of the lineshape's (shape) parameters
+  static constexpr unsigned int n_shape_parameters =
+      Lineshape<T>::n_parameters;
+
+  /// number of (ROOT) parameters
+  static constexpr unsigned int n_parameters =
+      3 + n_shape_parameters + n_lines;
+
+  /// number of frequencies evaluated together (on the stack)
+  static constexpr std::size_t block_size = 256;
+
+  /// constructor.
+  QuadrupoleSplitResonance(T baseline, T larmor_frequency,
+                           T quadrupole_splitting,
+                           const std::array<T, n_shape_parameters> &shape,
+                           const std::array<T, n_lines> &amplitudes)
+      : _parameters{baseline, larmor_frequency, quadrupole_splitting} {
+    std::copy(shape.begin(), shape.end(), _parameters.begin() + 3);
+    std::copy(amplitudes.begin(), amplitudes.end(),
+              _parameters.begin() + 3 + n_shape_parameters);
+  };
+
+  /// constructor (from the ROOT parameters).
+  explicit QuadrupoleSplitResonance(const T *par) {
+    std::copy(par, par + n_parameters, _parameters.begin());
+  };
+
+  /// Return m - 1/2 for the given line (i.e., its position relative to the
+  /// Larmor frequency, in units of -quadrupole_splitting).
+  static constexpr T offset(unsigned int line) {
+    return Nucleus<T>::spin() - 0.5 - line;
+  };
+
+  /// Return the centre of the given line.
+  T position(unsigned int line) const {
+    return _parameters[1] - _parameters[2] * offset(line);
+  };
+
+  /// Return the asymmetry at a given frequency.
+  T operator()(T frequency) const {
+    T result;
+    evaluate(&frequency, 1, &result);
+    return result;
+  };
+
+  /// Return the asymmetry at a given frequency, and set gradient to its
+  /// derivatives with respect to the (ROOT) parameters.
+  T operator()(T frequency, T *gradient) const {
+    T result;
+    evaluate(&frequency, 1, &result, gradient);
+    return result;
+  };
+
+  /// Evaluate the asymmetry at n frequencies and, unless gradient is null,
+  /// its derivatives with respect to the (ROOT) parameters (into
+  /// gradient[i * n_parameters + j]).
+  void evaluate(const T *frequency, std::size_t n, T *result,
+                T *gradient = nullptr) const {
+    const T *shape = _parameters.data() + 3;
+    const T *amplitudes = shape + n_shape_parameters;
+    T detuning[block_size];
+    T value[block_size];
+    T derivative[(1 + n_shape_parameters) * block_size];
+    for (std::size_t i0 = 0; i0 < n; i0 += block_size) {
+      const std::size_t m = std::min(block_size, n - i0);
+      std::fill(result + i0, result + i0 + m, _parameters[0]);
+      if (gradient != nullptr) {
+        std::fill(gradient + i0 * n_parameters,
+                  gradient + (i0 + m) * n_parameters, T(0.0));
+      }
+      for (unsigned int l = 0; l < n_lines; ++l) {
+        const T centre = position(l);
+        const T amplitude = amplitudes[l];
+        for (std::size_t i = 0; i < m; ++i) {
+          detuning[i] = frequency[i0 + i] - centre;
+        }
+        Lineshape<T>::evaluate(detuning, m, shape, value,
+                               gradient != nullptr ? derivative : nullptr);
+        for (std::size_t i = 0; i < m; ++i) {
+          result[i0 + i] -= amplitude * value[i];
+        }
+        if (gradient != nullptr) {
+          for (std::size_t i = 0; i < m; ++i) {
+            T *g = gradient + (i0 + i) * n_parameters;
+            const T slope = amplitude * derivative[i];
+            g[1] += slope;
+            g[2] -= slope * offset(l);
+            for (unsigned int k = 0; k < n_shape_parameters; ++k) {
+              g[3 + k] -= amplitude * derivative[(k + 1) * m + i];
+            }
+            g[3 + n_shape_parameters + l] = -value[i];
+          }
+        }
+      }
+      if (gradient != nullptr) {
+        for (std::size_t i = 0; i < m; ++i) {
+          gradient[(i0 + i) * n_parameters] = 1.0;
+        }
+      }
+    }
+  };
+
+  /// Evaluate the asymmetry at each frequency.
+  void evaluate(const std::vector<T> &frequency,
+                std::vector<T> &result) const {
+    result.resize(frequency.size());
+    evaluate(frequency.data(), frequency.size(), result.data());
+  };
+
+  /// Evaluate the asymmetry, and its gradient (n_parameters per frequency),
+  /// at each frequency.
+  void evaluate(const std::vector<T> &frequency, std::vector<T> &result,
+                std::vector<T> &gradient) const {
+    result.resize(frequency.size());
+    gradient.resize(frequency.size() * n_parameters);
+    evaluate(frequency.data(), frequency.size(), result.data(),
+             gradient.data());
+  };
+
+private:
+  /// model parameters
+  std::array<T, n_parameters> _parameters;
+};
+
+} // namespace resonance
+
+} // namespace bnmr
+
+} // namespace triumf
+
+#endif // TRIUMF_BNMR_RESONANCE_SPECTRUM_HPP
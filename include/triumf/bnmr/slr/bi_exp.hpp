@@ -2,7 +2,9 @@
 #define TRIUMF_BNMR_SLR_BI_EXP_HPP
 
 #include <cmath>
+#include <cstddef>
 #include <triumf/bnmr/slr/exp.hpp>
+#include <vector>
 
 // TRIUMF: Canada's particle accelerator centre
 namespace triumf {
@@ -28,6 +30,60 @@ template <typename T = double> T pulsed_bi_exp(const T *x, const T *par) {
   return pulsed_bi_exp<T>(*x, par[0], par[1], par[2], par[3], par[4], par[5]);
 }
 
+/// \brief pulsed biexponential (for many times at once).
+template <typename T = double> class PulsedBiExp {
+public:
+  /// constructor.
+  PulsedBiExp(T nuclear_lifetime, T pulse_length, T asymmetry, T fraction_slow,
+              T slr_rate_slow, T slr_rate_fast)
+      : _asymmetry(asymmetry), _fraction_slow(fraction_slow),
+        _slow(nuclear_lifetime, pulse_length, asymmetry * fraction_slow,
+              slr_rate_slow),
+        _fast(nuclear_lifetime, pulse_length,
+              asymmetry * (1.0 - fraction_slow), slr_rate_fast){};
+
+  /// constructor (from the ROOT parameters).
+  explicit PulsedBiExp(const T *par)
+      : PulsedBiExp(par[0], par[1], par[2], par[3], par[4], par[5]){};
+
+  /// number of (ROOT) parameters
+  static constexpr unsigned int n_parameters = 6;
+
+  /// Return the asymmetry at a given time.
+  T operator()(T time) const { return _slow(time) + _fast(time); };
+
+  /// Return the asymmetry at a given time, and set gradient to its
+  /// derivatives with respect to the (ROOT) parameters.
+  T operator()(T time, T *gradient) const {
+    T slow[PulsedExp<T>::n_parameters];
+    T fast[PulsedExp<T>::n_parameters];
+    const T value = _slow(time, slow) + _fast(time, fast);
+    gradient[0] = slow[0] + fast[0];
+    gradient[1] = slow[1] + fast[1];
+    gradient[2] = _fraction_slow * slow[2] + (1.0 - _fraction_slow) * fast[2];
+    gradient[3] = _asymmetry * (slow[2] - fast[2]);
+    gradient[4] = slow[3];
+    gradient[5] = fast[3];
+    return value;
+  };
+
+  /// Evaluate the asymmetry at each time.
+  void evaluate(const std::vector<T> &time, std::vector<T> &result) const {
+    result.resize(time.size());
+    for (std::size_t i = 0; i < time.size(); ++i) {
+      result[i] = _slow(time[i]) + _fast(time[i]);
+    }
+  };
+
+private:
+  /// model parameters
+  T _asymmetry;
+  T _fraction_slow;
+  /// slow & fast components
+  PulsedExp<T> _slow;
+  PulsedExp<T> _fast;
+};
+
 } // namespace slr
 
 } // namespace bnmr
@@ -4,6 +4,8 @@
 #include <boost/math/quadrature/tanh_sinh.hpp>
 #include <cmath>
 #include <triumf/bnmr/slr/common.hpp>
+#include <triumf/bnmr/slr/str_exp.hpp>
+#include <vector>
 
 // TRIUMF: Canada's particle accelerator centre
 namespace triumf {
@@ -57,6 +59,63 @@ template <typename T = double> T pulsed_cbrt_exp(const T *x, const T *par) {
   return pulsed_cbrt_exp<T>(*x, par[0], par[1], par[2], par[3]);
 }
 
+/// \brief pulsed cube root exponential (for many times at once).
+/// \details exp(-cbrt(slr_rate u)) is a stretched exponential (with beta =
+/// 1/3), so its integrals are evaluated with fixed rules (see StrExpIntegral).
+template <typename T = double> class PulsedCbrtExp {
+public:
+  /// constructor.
+  PulsedCbrtExp(T nuclear_lifetime, T pulse_length, T asymmetry, T slr_rate)
+      : _nuclear_lifetime(nuclear_lifetime), _pulse_length(pulse_length),
+        _asymmetry(asymmetry),
+        _integral(nuclear_lifetime, slr_rate, T(1.0) / T(3.0)){};
+
+  /// constructor (from the ROOT parameters).
+  explicit PulsedCbrtExp(const T *par)
+      : PulsedCbrtExp(par[0], par[1], par[2], par[3]){};
+
+  /// number of (ROOT) parameters
+  static constexpr unsigned int n_parameters = 4;
+
+  /// Return the asymmetry at a given time.
+  T operator()(T time) const {
+    return pulsed_convolution<T>(time, _nuclear_lifetime, _pulse_length,
+                                 _asymmetry, _integral);
+  };
+
+  /// Return the asymmetry at a given time, and set gradient to its
+  /// derivatives with respect to the (ROOT) parameters.
+  T operator()(T time, T *gradient) const {
+    return pulsed_convolution<1, T>(
+        time, _nuclear_lifetime, _pulse_length, _asymmetry,
+        [this](T a, T b, auto visit) {
+          return _integral.quadrature(a, b, visit);
+        },
+        [this](T u, T *d) {
+          // (beta is fixed)
+          T d_str_exp[2];
+          const T f = _integral.integrand(u, d_str_exp);
+          d[0] = d_str_exp[0];
+          return f;
+        },
+        gradient);
+  };
+
+  /// Evaluate the asymmetry at each time.
+  void evaluate(const std::vector<T> &time, std::vector<T> &result) const {
+    pulsed_convolution<T>(time, _nuclear_lifetime, _pulse_length, _asymmetry,
+                          _integral, result);
+  };
+
+private:
+  /// model parameters
+  T _nuclear_lifetime;
+  T _pulse_length;
+  T _asymmetry;
+  /// integral of the pulse's integrand
+  StrExpIntegral<T> _integral;
+};
+
 } // namespace slr
 
 } // namespace bnmr
@@ -1,7 +1,13 @@
 #ifndef TRIUMF_BNMR_SLR_COMMON_HPP
 #define TRIUMF_BNMR_SLR_COMMON_HPP
 
+#include <algorithm>
+#include <array>
+#include <boost/math/quadrature/gauss.hpp>
 #include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
 
 // TRIUMF: Canada's particle accelerator centre
 namespace triumf {
@@ -17,10 +23,244 @@ template <typename T = double> T normalization(T time, T nuclear_lifetime) {
   return nuclear_lifetime * (1.0 - std::exp(-time / nuclear_lifetime));
 }
 
+/// \brief Evaluate a pulsed SLR model at each time (e.g., a histogram's bins).
+/// \details The model is constructed (once) from its parameters, in the same
+/// order as its ROOT adapter, such that all of the parameter-dependent
+/// invariants are computed only once.
+template <typename Model, typename T>
+void evaluate(const std::vector<T> &time, const T *par,
+              std::vector<T> &result) {
+  const Model model(par);
+  model.evaluate(time, result);
+}
+
+/// \brief N-point Gauss-Legendre rule on [a, b], node by node.
+/// \details visit(u, w) is called for each node u (with weight w) and must
+/// return the integrand at u. The weighted sum of these values (i.e., the
+/// integral) is returned.
+template <std::size_t N, typename T = double, typename Visitor>
+T gauss_legendre(T a, T b, Visitor visit) {
+  const auto &x = boost::math::quadrature::gauss<T, N>::abscissa();
+  const auto &w = boost::math::quadrature::gauss<T, N>::weights();
+  const T half_width = 0.5 * (b - a);
+  const T mid_point = 0.5 * (a + b);
+  T sum = 0.0;
+  for (std::size_t k = 0; k < x.size(); ++k) {
+    const T weight = half_width * w[k];
+    if (x[k] == 0.0) {
+      sum += weight * visit(mid_point, weight);
+    } else {
+      sum += weight * visit(mid_point - half_width * x[k], weight);
+      sum += weight * visit(mid_point + half_width * x[k], weight);
+    }
+  }
+  return sum;
+}
+
+/// \brief 10-point Gauss-Legendre rules on each of several segments of
+/// [a, b] (with a >= 0), node by node (see gauss_legendre).
+/// \details The segments are no longer than h (e.g., the scale over which the
+/// integrand varies) nor than their distance from a singularity of the
+/// integrand at u = -distance (if any), such that the (fixed) rule is
+/// accurate on each of them.
+template <typename T = double, typename Visitor>
+T segmented_quadrature(T a, T b, T h, T distance, Visitor visit) {
+  T sum = 0.0;
+  T lo = a;
+  while (lo < b) {
+    T step = std::min(h, lo + distance);
+    if (not(step > 0.0) or std::isnan(step)) {
+      step = b - lo;
+    }
+    const T hi = std::min(b, lo + step);
+    sum += gauss_legendre<10, T>(lo, hi, visit);
+    lo = hi;
+  }
+  return sum;
+}
+
+/// integral of f over [a, b] using segmented_quadrature
+template <typename T = double, typename Function>
+T segmented_integral(Function f, T a, T b, T h,
+                     T distance = std::numeric_limits<T>::infinity()) {
+  return segmented_quadrature<T>(a, b, h, distance,
+                                 [&f](T u, T) { return f(u); });
+}
+
+/// \brief pulsed SLR model whose integrand depends only on u = time - t_p.
+/// \details For such models, the integrand is exp(-u / tau) R(u), where R(u)
+/// is the relaxation function, and integral(a, b) returns its integral over
+/// [a, b].
+template <typename T = double, typename Integral>
+T pulsed_convolution(T time, T nuclear_lifetime, T pulse_length, T asymmetry,
+                     Integral integral) {
+  if (time == 0.0) {
+    return asymmetry;
+  } else if (time > 0.0 and time <= pulse_length) {
+    return asymmetry * integral(T(0.0), time) /
+           normalization<T>(time, nuclear_lifetime);
+  } else if (time > pulse_length) {
+    return (asymmetry * integral(time - pulse_length, time) /
+            normalization<T>(pulse_length, nuclear_lifetime)) /
+           std::exp(-(time - pulse_length) / nuclear_lifetime);
+  } else {
+    return 0.0;
+  }
+}
+
+/// \brief pulsed SLR model whose integrand depends only on u = time - t_p
+/// (for many times at once).
+/// \details The integrals for all of the times share the same integrand, so
+/// it is integrated once over each interval between consecutive (sorted)
+/// integration limits. The result for each time is then a sum of these
+/// partial integrals: from 0 to the time during the pulse, and over the pulse
+/// window [time - pulse_length, time] after it.
+template <typename T = double, typename Integral>
+void pulsed_convolution(const std::vector<T> &time, T nuclear_lifetime,
+                        T pulse_length, T asymmetry, Integral integral,
+                        std::vector<T> &result) {
+  result.assign(time.size(), 0.0);
+  // all of the integration limits
+  std::vector<T> limits = {0.0};
+  limits.reserve(2 * time.size() + 1);
+  for (const auto &t : time) {
+    if (t > 0.0) {
+      limits.push_back(t);
+      if (t > pulse_length) {
+        limits.push_back(t - pulse_length);
+      }
+    }
+  }
+  // (merging those that differ only by round-off)
+  const T tolerance = 8.0 * std::numeric_limits<T>::epsilon();
+  std::sort(limits.begin(), limits.end());
+  limits.erase(std::unique(limits.begin(), limits.end(),
+                           [=](T a, T b) { return b - a <= tolerance * b; }),
+               limits.end());
+  // the partial integrals between consecutive limits...
+  std::vector<T> partial(limits.size(), 0.0);
+  for (std::size_t j = 1; j < limits.size(); ++j) {
+    partial[j] = integral(limits[j - 1], limits[j]);
+  }
+  // ...and their cumulative sums (for times during the pulse)
+  std::vector<T> cumulative(partial);
+  for (std::size_t j = 1; j < cumulative.size(); ++j) {
+    cumulative[j] += cumulative[j - 1];
+  }
+  // index of the (largest) limit <= u
+  auto index = [&limits](T u) -> std::size_t {
+    return std::upper_bound(limits.begin(), limits.end(), u) -
+           limits.begin() - 1;
+  };
+  // post-pulse invariant
+  const T scale = asymmetry / normalization<T>(pulse_length, nuclear_lifetime);
+  for (std::size_t i = 0; i < time.size(); ++i) {
+    const T t = time[i];
+    if (t == 0.0) {
+      result[i] = asymmetry;
+    } else if (t > 0.0 and t <= pulse_length) {
+      result[i] = asymmetry * cumulative[index(t)] /
+                  normalization<T>(t, nuclear_lifetime);
+    } else if (t > pulse_length) {
+      // sum over the pulse window directly (rather than as a difference of
+      // cumulative sums) to avoid cancellation at late times
+      const std::size_t last = index(t);
+      T sum = 0.0;
+      for (std::size_t j = index(t - pulse_length) + 1; j <= last; ++j) {
+        sum += partial[j];
+      }
+      result[i] =
+          scale * sum / std::exp(-(t - pulse_length) / nuclear_lifetime);
+    }
+  }
+}
+
+/// \brief Value and gradient of a pulsed SLR model from its pulse integral.
+/// \details The gradient is with respect to (nuclear_lifetime, pulse_length,
+/// asymmetry, p_1, ..., p_N), where p_j are the parameters of the relaxation
+/// function R(u). For time > 0, the inputs are: the integral of
+/// exp(-u / tau) R(u) over the pulse window (i.e., [0, time] during the pulse
+/// and [time - pulse_length, time] after it), its derivatives with respect to
+/// nuclear_lifetime and p_j, and (after the pulse only) the integrand at
+/// u = time - pulse_length, which sets the derivative with respect to
+/// pulse_length.
+template <std::size_t N, typename T = double>
+T pulsed_gradient(T time, T nuclear_lifetime, T pulse_length, T asymmetry,
+                  T integral, T integral_tau, const T *integral_p,
+                  T integrand_start, T *gradient) {
+  std::fill(gradient, gradient + 3 + N, T(0.0));
+  if (time == 0.0) {
+    gradient[2] = 1.0;
+    return asymmetry;
+  } else if (not(time > 0.0)) {
+    return 0.0;
+  }
+  const bool during_pulse = time <= pulse_length;
+  // normalization (and its derivative with respect to nuclear_lifetime)
+  const T t_n = during_pulse ? time : pulse_length;
+  const T e_n = std::exp(-t_n / nuclear_lifetime);
+  const T n = normalization<T>(t_n, nuclear_lifetime);
+  const T n_tau = (1.0 - e_n) - (t_n / nuclear_lifetime) * e_n;
+  // post-pulse factor 1 / exp(-(time - pulse_length) / tau)
+  const T g =
+      during_pulse ? 1.0 : std::exp((time - pulse_length) / nuclear_lifetime);
+  const T value = asymmetry * integral / n * g;
+  gradient[0] = asymmetry * g * (integral_tau / n - integral * n_tau / (n * n));
+  gradient[2] = g * integral / n;
+  for (std::size_t j = 0; j < N; ++j) {
+    gradient[3 + j] = asymmetry * g * integral_p[j] / n;
+  }
+  if (not during_pulse) {
+    gradient[0] -= value * (time - pulse_length) /
+                   (nuclear_lifetime * nuclear_lifetime);
+    // the lower limit of the integral, the normalization (whose derivative is
+    // e_n) and the post-pulse factor all depend on pulse_length
+    gradient[1] =
+        asymmetry * g * (integrand_start / n - integral * e_n / (n * n)) -
+        value / nuclear_lifetime;
+  }
+  return value;
+}
+
+/// \brief pulsed SLR model whose integrand depends only on u = time - t_p,
+/// and its gradient (see pulsed_gradient).
+/// \details The derivatives are taken under the integral sign, such that the
+/// integrand and its derivatives are evaluated at the same nodes:
+/// quadrature(a, b, visit) calls visit(u, w) for each node u (with weight w)
+/// of a fixed rule on [a, b] (see gauss_legendre), while integrand(u, d)
+/// returns exp(-u / tau) R(u) and sets d[j] to its derivative with respect to
+/// p_j.
+template <std::size_t N, typename T = double, typename Quadrature,
+          typename Integrand>
+T pulsed_convolution(T time, T nuclear_lifetime, T pulse_length, T asymmetry,
+                     Quadrature quadrature, Integrand integrand, T *gradient) {
+  if (not(time > 0.0)) {
+    return pulsed_gradient<N, T>(time, nuclear_lifetime, pulse_length,
+                                 asymmetry, 0.0, 0.0, nullptr, 0.0, gradient);
+  }
+  const T a = time <= pulse_length ? T(0.0) : time - pulse_length;
+  const T inverse_tau_squared = 1.0 / (nuclear_lifetime * nuclear_lifetime);
+  T integral_tau = 0.0;
+  std::array<T, N> integral_p = {};
+  std::array<T, N> d = {};
+  const T integral = quadrature(a, time, [&](T u, T w) {
+    const T f = integrand(u, d.data());
+    integral_tau += w * f * u * inverse_tau_squared;
+    for (std::size_t j = 0; j < N; ++j) {
+      integral_p[j] += w * d[j];
+    }
+    return f;
+  });
+  const T integrand_start = a > 0.0 ? integrand(a, d.data()) : T(0.0);
+  return pulsed_gradient<N, T>(time, nuclear_lifetime, pulse_length, asymmetry,
+                               integral, integral_tau, integral_p.data(),
+                               integrand_start, gradient);
+}
+
 } // namespace slr
 
 } // namespace bnmr
 
 } // namespace triumf
 
-#endif // TRIUMF_BNMR_SLR_COMMON_HPP
\ No newline at end of file
+#endif // TRIUMF_BNMR_SLR_COMMON_HPP
@@ -1,8 +1,11 @@
 #ifndef TRIUMF_BNMR_SLR_EXP_HPP
 #define TRIUMF_BNMR_SLR_EXP_HPP
 
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <triumf/bnmr/slr/common.hpp>
+#include <vector>
 
 // TRIUMF: Canada's particle accelerator centre
 namespace triumf {
@@ -47,6 +50,117 @@ template <typename T = double> T pulsed_exp(const T *x, const T *par) {
   return pulsed_exp<T>(*x, par[0], par[1], par[2], par[3]);
 }
 
+/// \brief pulsed exponential (for many times at once).
+/// \details The parameter-dependent invariants, including the asymmetry at
+/// the end of the pulse (which sets the amplitude of the post-pulse
+/// relaxation), are computed once, upon construction. Each time then costs
+/// (at most) two exponentials.
+template <typename T = double> class PulsedExp {
+public:
+  /// constructor.
+  PulsedExp(T nuclear_lifetime, T pulse_length, T asymmetry, T slr_rate)
+      : _nuclear_lifetime(nuclear_lifetime), _pulse_length(pulse_length),
+        _asymmetry(asymmetry), _slr_rate(slr_rate),
+        _rate(1.0 / nuclear_lifetime + slr_rate),
+        _scale(asymmetry / (slr_rate * nuclear_lifetime + 1.0)),
+        _asymmetry_end(pulsed(pulse_length)){};
+
+  /// constructor (from the ROOT parameters).
+  explicit PulsedExp(const T *par)
+      : PulsedExp(par[0], par[1], par[2], par[3]){};
+
+  /// number of (ROOT) parameters
+  static constexpr unsigned int n_parameters = 4;
+
+  /// Return the asymmetry at a given time.
+  T operator()(T time) const {
+    if (time == 0.0) {
+      return _asymmetry;
+    } else if (time > 0.0 and time <= _pulse_length) {
+      return pulsed(time);
+    } else if (time > _pulse_length) {
+      return _asymmetry_end * std::exp(-_slr_rate * (time - _pulse_length));
+    } else {
+      return 0.0;
+    }
+  };
+
+  /// Return the asymmetry at a given time, and set gradient to its
+  /// derivatives with respect to the (ROOT) parameters.
+  T operator()(T time, T *gradient) const {
+    std::fill(gradient, gradient + n_parameters, T(0.0));
+    if (time == 0.0) {
+      gradient[2] = 1.0;
+      return _asymmetry;
+    } else if (time > 0.0 and time <= _pulse_length) {
+      return pulsed(time, gradient);
+    } else if (time > _pulse_length) {
+      // the post-pulse relaxation of the asymmetry at the end of the pulse
+      const T decay = std::exp(-_slr_rate * (time - _pulse_length));
+      const T value = pulsed(_pulse_length, gradient) * decay;
+      gradient[0] *= decay;
+      gradient[1] = pulsed_slope(_pulse_length) * decay + _slr_rate * value;
+      gradient[2] *= decay;
+      gradient[3] = gradient[3] * decay - (time - _pulse_length) * value;
+      return value;
+    } else {
+      return 0.0;
+    }
+  };
+
+  /// Evaluate the asymmetry at each time.
+  void evaluate(const std::vector<T> &time, std::vector<T> &result) const {
+    result.resize(time.size());
+    for (std::size_t i = 0; i < time.size(); ++i) {
+      result[i] = (*this)(time[i]);
+    }
+  };
+
+private:
+  /// asymmetry during the pulse (0 < time <= pulse_length)
+  T pulsed(T time) const {
+    return _scale * std::expm1(-_rate * time) /
+           std::expm1(-time / _nuclear_lifetime);
+  };
+
+  /// asymmetry during the pulse, and its derivatives with respect to the
+  /// parameters (except pulse_length, on which it does not depend)
+  T pulsed(T time, T *gradient) const {
+    const T denominator = std::expm1(-time / _nuclear_lifetime);
+    const T ratio = std::expm1(-_rate * time) / denominator;
+    const T value = _scale * ratio;
+    const T factor = _slr_rate * _nuclear_lifetime + 1.0;
+    const T t_tau_squared = time / (_nuclear_lifetime * _nuclear_lifetime);
+    gradient[0] = -value * _slr_rate / factor +
+                  (_scale * std::exp(-_rate * time) -
+                   value * std::exp(-time / _nuclear_lifetime)) *
+                      t_tau_squared / denominator;
+    gradient[2] = ratio / factor;
+    gradient[3] = -value * _nuclear_lifetime / factor -
+                  _scale * time * std::exp(-_rate * time) / denominator;
+    return value;
+  };
+
+  /// time derivative of the asymmetry during the pulse
+  T pulsed_slope(T time) const {
+    const T denominator = std::expm1(-time / _nuclear_lifetime);
+    return (-_scale * _rate * std::exp(-_rate * time) +
+            pulsed(time) * std::exp(-time / _nuclear_lifetime) /
+                _nuclear_lifetime) /
+           denominator;
+  };
+
+  /// model parameters
+  T _nuclear_lifetime;
+  T _pulse_length;
+  T _asymmetry;
+  T _slr_rate;
+  /// invariants
+  T _rate;
+  T _scale;
+  T _asymmetry_end;
+};
+
 } // namespace slr
 
 } // namespace bnmr
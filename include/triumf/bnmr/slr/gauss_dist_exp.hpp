@@ -4,7 +4,9 @@
 #include <boost/math/constants/constants.hpp>
 #include <boost/math/quadrature/tanh_sinh.hpp>
 #include <cmath>
+#include <limits>
 #include <triumf/bnmr/slr/common.hpp>
+#include <vector>
 
 // TRIUMF: Canada's particle accelerator centre
 namespace triumf {
@@ -75,6 +77,119 @@ T pulsed_gauss_dist_exp(const T *x, const T *par) {
   return pulsed_gauss_dist_exp<T>(*x, par[0], par[1], par[2], par[3], par[4]);
 }
 
+/// \brief pulsed Gaussian distribution of exponentials (for many times at
+/// once).
+/// \details Written in terms of u = time - t_p, the integrand is
+///
+///   exp(-u / tau) exp(sigma^2 u^2 / 2 - slr_rate u)
+///     erfc((sigma^2 u - slr_rate) / (sqrt(2) sigma))
+///     / erfc(-slr_rate / (sqrt(2) sigma)),
+///
+/// which is smooth, so its integrals are evaluated with fixed rules on
+/// segments no longer than (twice) its decay length.
+template <typename T = double> class PulsedGaussDistExp {
+public:
+  /// constructor.
+  PulsedGaussDistExp(T nuclear_lifetime, T pulse_length, T asymmetry,
+                     T slr_rate, T sigma)
+      : _nuclear_lifetime(nuclear_lifetime), _pulse_length(pulse_length),
+        _asymmetry(asymmetry), _slr_rate(slr_rate), _sigma(sigma),
+        _inverse_norm(1.0 / std::erfc(-slr_rate / sigma /
+                                      boost::math::constants::root_two<T>())),
+        _norm_slope(boost::math::constants::two_div_root_pi<T>() *
+                    std::exp(-0.5 * slr_rate * slr_rate / (sigma * sigma)) *
+                    _inverse_norm),
+        _segment(2.0 / (1.0 / nuclear_lifetime + std::abs(slr_rate) +
+                        std::abs(sigma))){};
+
+  /// constructor (from the ROOT parameters).
+  explicit PulsedGaussDistExp(const T *par)
+      : PulsedGaussDistExp(par[0], par[1], par[2], par[3], par[4]){};
+
+  /// number of (ROOT) parameters
+  static constexpr unsigned int n_parameters = 5;
+
+  /// Return the asymmetry at a given time.
+  T operator()(T time) const {
+    return pulsed_convolution<T>(time, _nuclear_lifetime, _pulse_length,
+                                 _asymmetry, integral());
+  };
+
+  /// Return the asymmetry at a given time, and set gradient to its
+  /// derivatives with respect to the (ROOT) parameters.
+  T operator()(T time, T *gradient) const {
+    return pulsed_convolution<2, T>(
+        time, _nuclear_lifetime, _pulse_length, _asymmetry,
+        [this](T a, T b, auto visit) {
+          return segmented_quadrature<T>(
+              a, b, _segment, std::numeric_limits<T>::infinity(), visit);
+        },
+        [this](T u, T *d) { return integrand(u, d); }, gradient);
+  };
+
+  /// Evaluate the asymmetry at each time.
+  void evaluate(const std::vector<T> &time, std::vector<T> &result) const {
+    pulsed_convolution<T>(time, _nuclear_lifetime, _pulse_length, _asymmetry,
+                          integral(), result);
+  };
+
+private:
+  /// integrand of the pulse's integral (without the erfc factor)
+  T exponential(T u) const {
+    return std::exp(-u / _nuclear_lifetime +
+                    boost::math::constants::half<T>() * _sigma * _sigma * u *
+                        u -
+                    _slr_rate * u) *
+           _inverse_norm;
+  };
+
+  /// argument of the erfc factor
+  T argument(T u) const {
+    return (u * _sigma * _sigma - _slr_rate) / _sigma /
+           boost::math::constants::root_two<T>();
+  };
+
+  /// integrand of the pulse's integral
+  T integrand(T u) const { return exponential(u) * std::erfc(argument(u)); };
+
+  /// integrand of the pulse's integral, and its derivatives with respect to
+  /// (slr_rate, sigma)
+  T integrand(T u, T *d) const {
+    const T x = exponential(u);
+    const T q = argument(u);
+    const T f = x * std::erfc(q);
+    // the (negative) derivative of erfc(q), times the exponential part
+    const T x_slope =
+        x * boost::math::constants::two_div_root_pi<T>() * std::exp(-q * q);
+    const T root_two_sigma = boost::math::constants::root_two<T>() * _sigma;
+    d[0] = -u * f + (x_slope - f * _norm_slope) / root_two_sigma;
+    d[1] = _sigma * u * u * f -
+           x_slope * (u / boost::math::constants::root_two<T>() +
+                      _slr_rate / (root_two_sigma * _sigma)) +
+           f * _norm_slope * _slr_rate / (root_two_sigma * _sigma);
+    return f;
+  };
+
+  /// integral of the pulse's integrand over [a, b]
+  auto integral() const {
+    return [this](T a, T b) {
+      return segmented_integral<T>([this](T u) { return integrand(u); }, a,
+                                   b, _segment);
+    };
+  };
+
+  /// model parameters
+  T _nuclear_lifetime;
+  T _pulse_length;
+  T _asymmetry;
+  T _slr_rate;
+  T _sigma;
+  /// invariants
+  T _inverse_norm;
+  T _norm_slope;
+  T _segment;
+};
+
 } // namespace slr
 
 } // namespace bnmr
@@ -14,7 +14,12 @@
 #define TRIUMF_BNMR_SLR_MAGNESIUM_31_DECAY_CORRECTIONS_HPP
 
 #include <cmath>
+#include <cstddef>
 #include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include <triumf/bnmr/decay_chain.hpp>
 
 // TRIUMF: Canada's particle accelerator centre
 namespace triumf {
@@ -311,7 +316,7 @@ double n_31P(double time, double beam_pulse, double beam_rate) {
     double n_31Mg_0 = s_31Mg(beam_pulse, beam_rate, 0);
     double n_31Al_0 = s_31Al(beam_pulse, beam_rate, 0, 0);
     double n_31Si_0 = s_31Si(beam_pulse, beam_rate, 0, 0, 0);
-    double n_31P_0 = s_31P(time, beam_rate, 0, 0, 0, 0);
+    double n_31P_0 = s_31P(beam_pulse, beam_rate, 0, 0, 0, 0);
     return s_31P(delta, 0, n_31Mg_0, n_31Al_0, n_31Si_0, n_31P_0);
   }
   return 0.0;
@@ -513,6 +518,98 @@ double fa_30Si(double time, double beam_pulse, double beam_rate) {
          a_total(time, beam_pulse, beam_rate);
 }
 
+/// \brief Magnesium-31 decay chain (cf. the closed forms above).
+template <typename T = double> DecayChain<T> decay_chain() {
+  DecayChain<T> chain;
+  chain.add_nuclide("31Mg", T_12_31Mg, e_31Mg);
+  chain.add_nuclide("31Al", T_12_31Al, e_31Al);
+  chain.add_nuclide("31Si", T_12_31Si, e_31Si);
+  chain.add_nuclide("31P", T_12_31P, e_31P);
+  chain.add_nuclide("30Al", T_12_30Al, e_30Al);
+  chain.add_nuclide("30Si", T_12_30Si, e_30Si);
+  chain.add_branch("31Mg", "31Al", b_31Mg);
+  chain.add_branch("31Mg", "30Al", 1.0 - b_31Mg);
+  chain.add_branch("31Al", "31Si", b_31Al);
+  chain.add_branch("31Al", "30Si", 1.0 - b_31Al);
+  chain.add_branch("31Si", "31P", 1.0);
+  chain.add_branch("30Al", "30Si", 1.0);
+  return chain;
+}
+
+/// \brief Magnesium-31 decay corrections for a given beam pulse.
+/// \details The populations of the decay chain (see decay_chain) are solved
+/// once per (beam_pulse, beam_rate), upon construction (see
+/// DecayChain::Pulse), such that each time costs only four exponentials
+/// (one per beta-active member: 31Mg, 31Al, 31Si, and 30Al), which are
+/// shared by all of the activities (cf. fa_31Mg and friends, which
+/// re-evaluate the full closed forms for every species and every call).
+template <typename T = double> class DecayCorrections {
+public:
+  /// beta-active members of the decay chain
+  enum class Nuclide { magnesium_31, aluminum_31, silicon_31, aluminum_30 };
+
+  /// constructor.
+  explicit DecayCorrections(T beam_pulse, T beam_rate = 1e6)
+      : _pulse(pulse(beam_pulse, beam_rate)){};
+
+  /// Return the fractional activity of magnesium-31 (cf. fa_31Mg) at a given
+  /// time (for time <= 0, the limit time -> 0+ is returned, i.e., 1).
+  T operator()(T time) const {
+    return fractional_activity(Nuclide::magnesium_31, time);
+  };
+
+  /// Evaluate the fractional activity of magnesium-31 at each time.
+  void operator()(const std::vector<T> &time, std::vector<T> &result) const {
+    _pulse.detected_fraction(index(Nuclide::magnesium_31), time, result);
+  };
+
+  /// Return the fractional activity of magnesium-31 at each time.
+  std::vector<T> operator()(const std::vector<T> &time) const {
+    std::vector<T> result;
+    (*this)(time, result);
+    return result;
+  };
+
+  /// Return the activity of a member of the chain at a given time (cf.
+  /// a_31Mg, a_31Al, a_31Si, and a_30Al).
+  T activity(Nuclide nuclide, T time) const {
+    return _pulse.activity(index(nuclide), time);
+  };
+
+  /// Return the fractional activity of a member of the chain at a given time
+  /// (cf. fa_31Mg, fa_31Al, fa_31Si, and fa_30Al). For time <= 0, the limit
+  /// time -> 0+ is returned (i.e., 1 for magnesium-31 and 0 otherwise).
+  T fractional_activity(Nuclide nuclide, T time) const {
+    return _pulse.detected_fraction(index(nuclide), time);
+  };
+
+  /// Return the beam pulse length (s).
+  T beam_pulse() const { return _pulse.beam_pulse(); };
+
+  /// Return the beam rate (1/s).
+  T beam_rate() const { return _pulse.beam_rate(); };
+
+private:
+  /// populations of the chain for the beam pulse
+  static typename DecayChain<T>::Pulse pulse(T beam_pulse, T beam_rate) {
+    if (not(beam_pulse > 0.0)) {
+      throw std::domain_error("triumf::bnmr::slr::magnesium_31::"
+                              "DecayCorrections: invalid beam pulse");
+    }
+    static const DecayChain<T> chain = decay_chain<T>();
+    return chain.pulse(beam_pulse, beam_rate);
+  };
+
+  /// index of a nuclide in the chain
+  static std::size_t index(Nuclide nuclide) {
+    static const std::size_t indices[] = {0, 1, 2, 4};
+    return indices[static_cast<std::size_t>(nuclide)];
+  };
+
+  /// populations of the chain
+  typename DecayChain<T>::Pulse _pulse;
+};
+
 } // namespace magnesium_31
 
 } // namespace slr
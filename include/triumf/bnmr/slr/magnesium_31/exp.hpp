@@ -1,8 +1,13 @@
 #ifndef TRIUMF_BNMR_SLR_MAGNESIUM_31_EXP_HPP
 #define TRIUMF_BNMR_SLR_MAGNESIUM_31_EXP_HPP
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
 #include <triumf/bnmr/slr/exp.hpp>
 #include <triumf/bnmr/slr/magnesium_31/decay_corrections.hpp>
+#include <vector>
 
 // TRIUMF: Canada's particle accelerator centre
 namespace triumf {
@@ -26,8 +31,13 @@ T pulsed_exp(T time, T nuclear_lifetime, T pulse_length, T asymmetry,
     return asymmetry;
     // use the "usual" evaluation approach for finite positive times
   } else if (time > 0.0) {
-    T beam_rate = 1e6;
-    return fa_31Mg(time, pulse_length, beam_rate) *
+    // the decay corrections are only re-tabulated (by each thread) when the
+    // pulse length changes
+    static thread_local DecayCorrections<T> corrections(pulse_length);
+    if (corrections.beam_pulse() != pulse_length) {
+      corrections = DecayCorrections<T>(pulse_length);
+    }
+    return corrections(time) *
            triumf::bnmr::slr::pulsed_exp<T>(time, nuclear_lifetime,
                                             pulse_length, asymmetry, slr_rate);
     // return zero for negative times
@@ -42,6 +52,76 @@ template <typename T = double> T pulsed_exp(const T *x, const T *par) {
                                                         par[2], par[3]);
 }
 
+/// \brief pulsed exponential with magnesium-31 decay corrections (for many
+/// times at once).
+/// \details The decay corrections are tabulated once, upon construction (see
+/// DecayCorrections), along with those for the (slightly) shifted pulse
+/// lengths used to differentiate them numerically.
+template <typename T = double> class PulsedExp {
+public:
+  /// constructor.
+  PulsedExp(T nuclear_lifetime, T pulse_length, T asymmetry, T slr_rate)
+      : _step(std::cbrt(std::numeric_limits<T>::epsilon()) *
+              std::max(T(1.0), pulse_length)),
+        _exp(nuclear_lifetime, pulse_length, asymmetry, slr_rate),
+        _corrections(pulse_length), _corrections_plus(pulse_length + _step),
+        _corrections_minus(
+            std::max(T(0.5) * pulse_length, pulse_length - _step)){};
+
+  /// constructor (from the ROOT parameters).
+  explicit PulsedExp(const T *par)
+      : PulsedExp(par[0], par[1], par[2], par[3]){};
+
+  /// number of (ROOT) parameters
+  static constexpr unsigned int n_parameters = 4;
+
+  /// Return the asymmetry at a given time.
+  T operator()(T time) const {
+    // (the corrections' limit at time = 0 is 1, and the asymmetry vanishes
+    // for negative times)
+    return _corrections(time) * _exp(time);
+  };
+
+  /// \brief Return the asymmetry at a given time, and set gradient to its
+  /// derivatives with respect to the (ROOT) parameters.
+  /// \details The decay correction's dependence on the pulse length is
+  /// differentiated numerically (by central differences).
+  T operator()(T time, T *gradient) const {
+    const T value = _exp(time, gradient);
+    if (not(time > 0.0)) {
+      return value;
+    }
+    const T correction = _corrections(time);
+    for (unsigned int i = 0; i < n_parameters; ++i) {
+      gradient[i] *= correction;
+    }
+    gradient[1] += value *
+                   (_corrections_plus(time) - _corrections_minus(time)) /
+                   (_corrections_plus.beam_pulse() -
+                    _corrections_minus.beam_pulse());
+    return correction * value;
+  };
+
+  /// Evaluate the asymmetry at each time.
+  void evaluate(const std::vector<T> &time, std::vector<T> &result) const {
+    _corrections(time, result);
+    for (std::size_t i = 0; i < time.size(); ++i) {
+      result[i] *= _exp(time[i]);
+    }
+  };
+
+private:
+  /// step in the pulse length for differentiating the decay corrections
+  T _step;
+  /// pulsed exponential (without decay corrections)
+  triumf::bnmr::slr::PulsedExp<T> _exp;
+  /// decay corrections (at the pulse length, and shifted by +/- _step, but
+  /// by no more than half of it downwards)
+  DecayCorrections<T> _corrections;
+  DecayCorrections<T> _corrections_plus;
+  DecayCorrections<T> _corrections_minus;
+};
+
 } // namespace magnesium_31
 
 } // namespace slr
@@ -3,7 +3,9 @@
 
 #include <boost/math/quadrature/tanh_sinh.hpp>
 #include <cmath>
+#include <limits>
 #include <triumf/bnmr/slr/common.hpp>
+#include <vector>
 
 // TRIUMF: Canada's particle accelerator centre
 namespace triumf {
@@ -67,6 +69,104 @@ template <typename T = double> T pulsed_mod_str_exp(const T *x, const T *par) {
                                par[5]);
 }
 
+/// \brief pulsed modified stretched exponential (for many times at once).
+/// \details Written in terms of u = time - t_p, the integrand is
+/// exp(-u / tau) exp(-(u / tau_0) (1 + u / tau_c)^(beta - 1)), whose only
+/// singularity is at u = -tau_c. Its integrals are evaluated with fixed rules
+/// on segments no longer than (twice) its (initial) decay length, nor than
+/// their distance from the singularity.
+/// https://doi.org/10.1006/jmra.1996.0029
+template <typename T = double> class PulsedModStrExp {
+public:
+  /// constructor.
+  PulsedModStrExp(T nuclear_lifetime, T pulse_length, T asymmetry,
+                  T slr_rate_initial, T slr_rate, T beta)
+      : _nuclear_lifetime(nuclear_lifetime), _pulse_length(pulse_length),
+        _asymmetry(asymmetry), _slr_rate_initial(slr_rate_initial),
+        _slr_rate(slr_rate), _beta(beta), _tau_0(1.0 / slr_rate_initial),
+        _tau_c(std::pow((1.0 / slr_rate) * std::pow(_tau_0, -1.0 / beta),
+                        beta / (beta - 1.0))),
+        _segment(2.0 / (1.0 / nuclear_lifetime + std::abs(slr_rate_initial) +
+                        std::abs(slr_rate))),
+        _distance(_tau_c > 0.0 ? _tau_c
+                               : std::numeric_limits<T>::infinity()){};
+
+  /// constructor (from the ROOT parameters).
+  explicit PulsedModStrExp(const T *par)
+      : PulsedModStrExp(par[0], par[1], par[2], par[3], par[4], par[5]){};
+
+  /// number of (ROOT) parameters
+  static constexpr unsigned int n_parameters = 6;
+
+  /// Return the asymmetry at a given time.
+  T operator()(T time) const {
+    return pulsed_convolution<T>(time, _nuclear_lifetime, _pulse_length,
+                                 _asymmetry, integral());
+  };
+
+  /// Return the asymmetry at a given time, and set gradient to its
+  /// derivatives with respect to the (ROOT) parameters.
+  T operator()(T time, T *gradient) const {
+    return pulsed_convolution<3, T>(
+        time, _nuclear_lifetime, _pulse_length, _asymmetry,
+        [this](T a, T b, auto visit) {
+          return segmented_quadrature<T>(a, b, _segment, _distance, visit);
+        },
+        [this](T u, T *d) { return integrand(u, d); }, gradient);
+  };
+
+  /// Evaluate the asymmetry at each time.
+  void evaluate(const std::vector<T> &time, std::vector<T> &result) const {
+    pulsed_convolution<T>(time, _nuclear_lifetime, _pulse_length, _asymmetry,
+                          integral(), result);
+  };
+
+private:
+  /// integrand of the pulse's integral
+  T integrand(T u) const {
+    return std::exp(-u / _nuclear_lifetime) *
+           std::exp(-(u / _tau_0) * std::pow(1.0 + (u / _tau_c), _beta - 1.0));
+  };
+
+  /// integrand of the pulse's integral, and its derivatives with respect to
+  /// (slr_rate_initial, slr_rate, beta), through those of ln(tau_c) =
+  /// (ln(slr_rate_initial) - beta ln(slr_rate)) / (beta - 1)
+  T integrand(T u, T *d) const {
+    const T x = u / _tau_c;
+    const T w = 1.0 + x;
+    const T z = (u / _tau_0) * std::pow(w, _beta - 1.0);
+    const T f = std::exp(-u / _nuclear_lifetime - z);
+    d[0] = -f * z / (_slr_rate_initial * w);
+    d[1] = -f * z * _beta * x / (_slr_rate * w);
+    d[2] = -f * z *
+           (std::log(w) - (x / w) * std::log(_slr_rate / _slr_rate_initial) /
+                              (_beta - 1.0));
+    return f;
+  };
+
+  /// integral of the pulse's integrand over [a, b]
+  auto integral() const {
+    return [this](T a, T b) {
+      return segmented_integral<T>([this](T u) { return integrand(u); }, a,
+                                   b, _segment, _distance);
+    };
+  };
+
+  /// model parameters
+  T _nuclear_lifetime;
+  T _pulse_length;
+  T _asymmetry;
+  T _slr_rate_initial;
+  T _slr_rate;
+  T _beta;
+  /// characteristic times (see Eqs. (4) to (7))
+  T _tau_0;
+  T _tau_c;
+  /// segment lengths & distance to the integrand's singularity
+  T _segment;
+  T _distance;
+};
+
 } // namespace slr
 
 } // namespace bnmr
@@ -0,0 +1,108 @@
+#ifndef TRIUMF_BNMR_SLR_PARAM_GRAD_FUNCTION_HPP
+#define TRIUMF_BNMR_SLR_PARAM_GRAD_FUNCTION_HPP
+
+// C++ standard library headers
+#include <algorithm>
+#include <array>
+#include <optional>
+#include <vector>
+
+// ROOT headers
+#include <Math/IParamFunction.h>
+
+// TRIUMF: Canada's particle accelerator centre
+namespace triumf {
+
+// β-detected nuclear magnetic resonance (β-NMR)
+namespace bnmr {
+
+// spin-lattice relaxation (SLR)
+namespace slr {
+
+/// \brief Pulsed SLR model as a ROOT parametric function with a gradient.
+/// \details Model is one of the pulsed SLR classes (e.g., PulsedExp,
+/// PulsedStrExp), which must be constructible from the (ROOT) parameters and
+/// provide n_parameters and operator()(time, gradient). The gradient with
+/// respect to the parameters is computed alongside the function value (i.e.,
+/// analytically or by differentiating the pulse's integral under the integral
+/// sign), such that it can be used directly by gradient-based minimizers
+/// (e.g., Minuit2 or Fumili) without any finite differences. The model (and
+/// any invariants it precomputes) is only rebuilt when the parameters change,
+/// i.e., once per fit iteration rather than once per data point.
+template <typename Model>
+class ParamGradFunction : public ROOT::Math::IParamMultiGradFunction {
+public:
+  /// constructor.
+  ParamGradFunction() : _parameters(Model::n_parameters, 0.0){};
+
+  /// constructor (with initial parameter values).
+  explicit ParamGradFunction(const double *par)
+      : _parameters(par, par + Model::n_parameters){};
+
+  /// Return a copy (required by ROOT).
+  ParamGradFunction *Clone() const override {
+    return new ParamGradFunction(*this);
+  };
+
+  /// Return the number of dimensions (i.e., time).
+  unsigned int NDim() const override { return 1; };
+
+  /// Return the number of parameters.
+  unsigned int NPar() const override { return Model::n_parameters; };
+
+  /// Return the current parameter values.
+  const double *Parameters() const override { return _parameters.data(); };
+
+  /// Set the parameter values.
+  void SetParameters(const double *par) override {
+    std::copy(par, par + Model::n_parameters, _parameters.begin());
+  };
+
+  /// Evaluate all of the parameter derivatives at once.
+  void ParameterGradient(const double *x, const double *par,
+                         double *grad) const override {
+    model(par != nullptr ? par : _parameters.data())(x[0], grad);
+  };
+
+private:
+  /// function value at x for the parameters par
+  double DoEvalPar(const double *x, const double *par) const override {
+    return model(par)(x[0]);
+  };
+
+  /// derivative with respect to par[i] at x
+  double DoParameterDerivative(const double *x, const double *par,
+                               unsigned int i) const override {
+    std::array<double, Model::n_parameters> grad;
+    model(par)(x[0], grad.data());
+    return grad[i];
+  };
+
+  /// \brief Return the model for the parameters par.
+  /// \details Each thread keeps its model, together with the parameters it
+  /// was built from, and only rebuilds it when they differ (such that
+  /// concurrent evaluations, e.g., in a multithreaded ROOT fit, are safe).
+  static const Model &model(const double *par) {
+    static thread_local std::array<double, Model::n_parameters>
+        model_parameters;
+    static thread_local std::optional<Model> cached_model;
+    if (not cached_model or
+        not std::equal(model_parameters.begin(), model_parameters.end(),
+                       par)) {
+      cached_model.emplace(par);
+      std::copy(par, par + Model::n_parameters, model_parameters.begin());
+    }
+    return *cached_model;
+  };
+
+  /// current parameter values
+  std::vector<double> _parameters;
+};
+
+} // namespace slr
+
+} // namespace bnmr
+
+} // namespace triumf
+
+#endif // TRIUMF_BNMR_SLR_PARAM_GRAD_FUNCTION_HPP
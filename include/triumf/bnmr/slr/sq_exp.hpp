@@ -3,7 +3,11 @@
 
 #include <boost/math/constants/constants.hpp>
 #include <cmath>
+#include <cstddef>
+#include <limits>
 #include <triumf/bnmr/slr/common.hpp>
+#include <triumf/math/faddeeva.hpp>
+#include <vector>
 
 // TRIUMF: Canada's particle accelerator centre
 namespace triumf {
@@ -14,22 +18,40 @@ namespace bnmr {
 // spin-lattice relaxation (SLR)
 namespace slr {
 
+/// \brief scaled complementary error function, exp(x^2) erfc(x).
+/// \details Where exp(x^2) would overflow (or erfc(x) underflow), it is
+/// evaluated (in double precision) by faddeeva::erfcx.
+template <typename T = double> T scaled_erfc(T x) {
+  // (i.e., x^2 comfortably below -log of the smallest normal number)
+  const T x_max = 0.9 * std::sqrt(-std::log(std::numeric_limits<T>::min()));
+  if (x < x_max) {
+    return std::exp(x * x) * std::erfc(x);
+  }
+  return static_cast<T>(
+      triumf::math::faddeeva::erfcx(static_cast<double>(x)));
+}
+
+/// \brief integral of the pulsed square exponential integrand,
+/// exp(-t / nuclear_lifetime - (slr_rate t)^2), from u to infinity.
+/// \details (√π / (2 slr_rate)) exp(x_0^2) erfc(x), where
+/// x_0 = 1 / (2 slr_rate nuclear_lifetime) and x = slr_rate u + x_0, is
+/// written as (√π / (2 slr_rate)) exp(x_0^2 - x^2) erfcx(x), which neither
+/// overflows for slow rates nor suffers from cancellation.
+template <typename T = double>
+T pulsed_sq_exp_tail(T u, T nuclear_lifetime, T slr_rate) {
+  const T x_0 = 1.0 / (2.0 * slr_rate * nuclear_lifetime);
+  const T v = slr_rate * u;
+  return (boost::math::constants::root_pi<T>() / (2.0 * slr_rate)) *
+         std::exp(-v * (v + 2.0 * x_0)) * scaled_erfc<T>(v + x_0);
+}
+
 /// pulsed square exponential integral (from 0 to time_p <= time)
 template <typename T = double>
 T pulsed_sq_exp_integral(T time, T time_p, T nuclear_lifetime, T slr_rate) {
   // make sure that
   assert(time >= time_p);
-  // break up the expression into smaller chunks
-  T term_1 = (boost::math::constants::root_pi<T>() / (2.0 * slr_rate)) *
-             std::exp(1.0 / (4.0 * slr_rate * slr_rate * nuclear_lifetime *
-                             nuclear_lifetime));
-  T term_2 =
-      std::erf((2.0 * time * slr_rate * slr_rate * nuclear_lifetime + 1.0) /
-               (2.0 * slr_rate * nuclear_lifetime));
-  T term_3 = std::erf(
-      ((2.0 * (time - time_p)) * slr_rate * slr_rate * nuclear_lifetime + 1.0) /
-      (2.0 * slr_rate * nuclear_lifetime));
-  return term_1 * (term_2 - term_3);
+  return pulsed_sq_exp_tail(time - time_p, nuclear_lifetime, slr_rate) -
+         pulsed_sq_exp_tail(time, nuclear_lifetime, slr_rate);
 }
 
 /// pulsed square exponential
@@ -58,6 +80,109 @@ template <typename T = double> T pulsed_sq_exp(const T *x, const T *par) {
   return pulsed_sq_exp<T>(*x, par[0], par[1], par[2], par[3]);
 }
 
+/// \brief pulsed square exponential (for many times at once).
+/// \details The parameter-dependent invariants (i.e., the prefactor and the
+/// offset of the complementary error function arguments) are computed once,
+/// upon construction. The integrals are evaluated with the scaled
+/// complementary error function (see pulsed_sq_exp_tail), such that slow
+/// rates do not overflow.
+template <typename T = double> class PulsedSqExp {
+public:
+  /// constructor.
+  PulsedSqExp(T nuclear_lifetime, T pulse_length, T asymmetry, T slr_rate)
+      : _nuclear_lifetime(nuclear_lifetime), _pulse_length(pulse_length),
+        _asymmetry(asymmetry), _slr_rate(slr_rate),
+        _offset(1.0 / (2.0 * slr_rate * nuclear_lifetime)),
+        _prefactor(boost::math::constants::root_pi<T>() / (2.0 * slr_rate)),
+        _tail_zero(tail(0.0)),
+        _scale(asymmetry / normalization<T>(pulse_length, nuclear_lifetime)){};
+
+  /// constructor (from the ROOT parameters).
+  explicit PulsedSqExp(const T *par)
+      : PulsedSqExp(par[0], par[1], par[2], par[3]){};
+
+  /// number of (ROOT) parameters
+  static constexpr unsigned int n_parameters = 4;
+
+  /// Return the asymmetry at a given time.
+  T operator()(T time) const {
+    if (time == 0.0) {
+      return _asymmetry;
+    } else if (time > 0.0 and time <= _pulse_length) {
+      return _asymmetry * (_tail_zero - tail(time)) /
+             normalization<T>(time, _nuclear_lifetime);
+    } else if (time > _pulse_length) {
+      return _scale * (tail(time - _pulse_length) - tail(time)) /
+             std::exp(-(time - _pulse_length) / _nuclear_lifetime);
+    } else {
+      return 0.0;
+    }
+  };
+
+  /// Return the asymmetry at a given time, and set gradient to its
+  /// derivatives with respect to the (ROOT) parameters.
+  T operator()(T time, T *gradient) const {
+    if (not(time > 0.0)) {
+      return pulsed_gradient<1, T>(time, _nuclear_lifetime, _pulse_length,
+                                   _asymmetry, 0.0, 0.0, nullptr, 0.0,
+                                   gradient);
+    }
+    // the (closed form) integral over [a, time] and its derivatives
+    const T a = time <= _pulse_length ? T(0.0) : time - _pulse_length;
+    T d_a[2];
+    T d_b[2];
+    const T integral = antiderivative(a, d_a) - antiderivative(time, d_b);
+    const T integral_slr_rate = d_a[1] - d_b[1];
+    const T integrand_start =
+        std::exp(-a / _nuclear_lifetime - _slr_rate * _slr_rate * a * a);
+    return pulsed_gradient<1, T>(time, _nuclear_lifetime, _pulse_length,
+                                 _asymmetry, integral, d_a[0] - d_b[0],
+                                 &integral_slr_rate, integrand_start,
+                                 gradient);
+  };
+
+  /// Evaluate the asymmetry at each time.
+  void evaluate(const std::vector<T> &time, std::vector<T> &result) const {
+    result.resize(time.size());
+    for (std::size_t i = 0; i < time.size(); ++i) {
+      result[i] = (*this)(time[i]);
+    }
+  };
+
+private:
+  /// integral of the integrand from u to infinity (see pulsed_sq_exp_tail)
+  T tail(T u) const {
+    const T v = _slr_rate * u;
+    return _prefactor * std::exp(-v * (v + 2.0 * _offset)) *
+           scaled_erfc<T>(v + _offset);
+  };
+
+  /// (minus) the antiderivative of the integrand, H(u) = prefactor
+  /// exp(offset^2) erfc(slr_rate u + offset), and its derivatives with
+  /// respect to (nuclear_lifetime, slr_rate)
+  T antiderivative(T u, T *d) const {
+    const T h = tail(u);
+    // prefactor exp(offset^2) times the (negative) derivative of erfc
+    const T k = std::exp(-_slr_rate * u * (_slr_rate * u + 2.0 * _offset)) /
+                _slr_rate;
+    d[0] = (-2.0 * _offset * _offset * h + k * _offset) / _nuclear_lifetime;
+    d[1] = -(1.0 + 2.0 * _offset * _offset) * h / _slr_rate -
+           k * (u - _offset / _slr_rate);
+    return h;
+  };
+
+  /// model parameters
+  T _nuclear_lifetime;
+  T _pulse_length;
+  T _asymmetry;
+  T _slr_rate;
+  /// invariants
+  T _offset;
+  T _prefactor;
+  T _tail_zero;
+  T _scale;
+};
+
 } // namespace slr
 
 } // namespace bnmr
@@ -1,9 +1,15 @@
 #ifndef TRIUMF_BNMR_SLR_STR_EXP_HPP
 #define TRIUMF_BNMR_SLR_STR_EXP_HPP
 
-#include <boost/math/quadrature/tanh_sinh.hpp>
+#include <algorithm>
+#include <boost/math/quadrature/gauss.hpp>
 #include <cmath>
+#include <cstddef>
+#include <limits>
+#include <memory>
 #include <triumf/bnmr/slr/common.hpp>
+#include <triumf/math/gauss_jacobi.hpp>
+#include <vector>
 
 // TRIUMF: Canada's particle accelerator centre
 namespace triumf {
@@ -14,20 +20,150 @@ namespace bnmr {
 // spin-lattice relaxation (SLR)
 namespace slr {
 
+/// \brief Integral of exp(-u / tau) exp(-(slr_rate u)^beta) over [a, b].
+/// \details Evaluated with fixed (i.e., non-adaptive) Gauss rules. Near u = 0,
+/// where the derivatives of (slr_rate u)^beta diverge (for beta < 1), the
+/// substitution v = (u / u_0)^beta leaves a Gauss-Jacobi integral with weight
+/// v^(1 / beta - 1). The rest of [a, b] is split into segments no longer than
+/// their distance from u = 0 (and over which the integrand decays by no more
+/// than ~exp(-2)), each of which is integrated with a 10-point Gauss-Legendre
+/// rule. Segments beyond the point where the integrand has become negligible
+/// are skipped.
+template <typename T = double> class StrExpIntegral {
+public:
+  /// constructor.
+  StrExpIntegral(T nuclear_lifetime, T slr_rate, T beta)
+      : _nuclear_lifetime(nuclear_lifetime), _slr_rate(slr_rate), _beta(beta),
+        _rule(jacobi_rule(beta)) {
+    // end of the Gauss-Jacobi segment: keep u / tau small (the rule does not
+    // absorb the non-smooth part of exp(-u / tau) in v, which is more severe
+    // for beta > 1), and slr_rate u <~ 1
+    _u_0 = std::ldexp(nuclear_lifetime, beta > 1.0 ? -26 : -13);
+    if (slr_rate > 0.0) {
+      _u_0 = std::min(_u_0, T(1.0) / slr_rate);
+    }
+  };
+
+  /// Return the integral over [a, b] (with 0 <= a <= b).
+  T operator()(T a, T b) const {
+    return quadrature(a, b, [this](T u, T) { return integrand(u); });
+  };
+
+  /// \brief Visit the nodes & weights of the rules on [a, b] (see
+  /// gauss_legendre), e.g., to integrate the integrand's derivatives along
+  /// with it.
+  /// \details visit(u, w) must return the integrand at u (which decides where
+  /// the remainder of the integral is negligible).
+  template <typename Visitor> T quadrature(T a, T b, Visitor visit) const {
+    if (not(b > a)) {
+      return 0.0;
+    }
+    T sum = 0.0;
+    T lo = std::max(a, T(0.0));
+    if (lo < _u_0) {
+      const T hi = std::min(b, _u_0);
+      sum = jacobi_quadrature(hi, T(1.0), visit);
+      if (lo > 0.0) {
+        sum -= jacobi_quadrature(lo, T(-1.0), visit);
+      }
+      lo = hi;
+    }
+    while (lo < b) {
+      // stop once the remainder is negligible (the integrand is decreasing)
+      if (integrand(lo) * (b - lo) <=
+          std::numeric_limits<T>::epsilon() * sum) {
+        break;
+      }
+      T hi = std::min(b, T(2.0) * lo);
+      const T slope = std::max(exponent_slope(lo), exponent_slope(hi));
+      hi = std::min(hi, lo + T(2.0) / slope);
+      // (much) shorter segments, e.g., between adjacent histogram bins, need
+      // fewer nodes
+      if (4.0 * (hi - lo) <= lo and (hi - lo) * slope <= 1.0) {
+        sum += gauss_legendre<7, T>(lo, hi, visit);
+      } else {
+        sum += gauss_legendre<10, T>(lo, hi, visit);
+      }
+      lo = hi;
+    }
+    return sum;
+  };
+
+  /// Return the integrand at u.
+  T integrand(T u) const {
+    return std::exp(-u / _nuclear_lifetime - std::pow(_slr_rate * u, _beta));
+  };
+
+  /// Return the integrand at u, and set d to its derivatives with respect to
+  /// (slr_rate, beta).
+  T integrand(T u, T *d) const {
+    const T x = _slr_rate * u;
+    const T y = std::pow(x, _beta);
+    const T f = std::exp(-u / _nuclear_lifetime - y);
+    // (without dividing by slr_rate, i.e., also at slr_rate = 0)
+    d[0] = u > 0.0 ? -f * _beta * std::pow(_slr_rate, _beta - 1.0) *
+                         std::pow(u, _beta)
+                   : T(0.0);
+    d[1] = y > 0.0 ? -f * y * std::log(x) : T(0.0);
+    return f;
+  };
+
+private:
+  /// derivative of the (negative) exponent of the integrand
+  T exponent_slope(T u) const {
+    return 1.0 / _nuclear_lifetime +
+           _beta * std::pow(_slr_rate, _beta) * std::pow(u, _beta - 1.0);
+  };
+
+  /// Gauss-Jacobi rule on [0, u], in terms of v = (u' / u)^beta (i.e., with
+  /// nodes u' = u v^(1 / beta)), with the weights scaled by sign
+  template <typename Visitor>
+  T jacobi_quadrature(T u, T sign, Visitor visit) const {
+    const T p = 1.0 / _beta;
+    const T scale = u * p * std::pow(T(2.0), -p);
+    const auto &x = _rule->abscissa();
+    const auto &w = _rule->weights();
+    T sum = 0.0;
+    for (std::size_t i = 0; i < x.size(); ++i) {
+      const T weight = scale * w[i];
+      sum += weight * visit(u * std::pow(0.5 * (1.0 + x[i]), p), sign * weight);
+    }
+    return sum;
+  };
+
+  /// Gauss-Jacobi rule for the weight v^(1 / beta - 1), shared by all
+  /// instances (in the same thread) with the same beta
+  static std::shared_ptr<const triumf::math::quadrature::gauss_jacobi<T>>
+  jacobi_rule(T beta) {
+    static thread_local T cached_beta = std::numeric_limits<T>::quiet_NaN();
+    static thread_local std::shared_ptr<
+        const triumf::math::quadrature::gauss_jacobi<T>>
+        rule;
+    if (not(beta == cached_beta)) {
+      rule = std::make_shared<const triumf::math::quadrature::gauss_jacobi<T>>(
+          16, 0.0, 1.0 / beta - 1.0);
+      cached_beta = beta;
+    }
+    return rule;
+  };
+
+  /// model parameters
+  T _nuclear_lifetime;
+  T _slr_rate;
+  T _beta;
+  /// end of the Gauss-Jacobi segment
+  T _u_0;
+  /// Gauss-Jacobi rule
+  std::shared_ptr<const triumf::math::quadrature::gauss_jacobi<T>> _rule;
+};
+
 /// pulsed stretched exponential integral (from 0 to time_p)
 template <typename T = double>
 T pulsed_str_exp_integral(T time, T time_p, T nuclear_lifetime, T slr_rate,
                           T beta) {
-  // integrand for the numeric integral
-  auto integrand = [=](T t_p) {
-    return std::exp(-(time - t_p) / nuclear_lifetime) *
-           std::exp(-std::pow(slr_rate * (time - t_p), beta));
-  };
-  // create the integrator for tanh-sinh quadrature
-  static boost::math::quadrature::tanh_sinh<T> integrator;
-  // evaluate the integral from 0 to time_p
-  T Q = integrator.integrate(integrand, 0.0, time_p);
-  return Q;
+  // with u = time - t_p, the integrand is exp(-u / tau) exp(-(slr_rate u)^beta)
+  const StrExpIntegral<T> integral(nuclear_lifetime, slr_rate, beta);
+  return integral(time - time_p, time);
 }
 
 /// pulsed stretched exponential
@@ -52,6 +188,66 @@ T pulsed_str_exp(T time, T nuclear_lifetime, T pulse_length, T asymmetry,
   }
 }
 
+/// \brief pulsed stretched exponential (for many times at once).
+/// \details The parameter-dependent parts of the integrand (e.g., the
+/// Gauss-Jacobi rule) are set up once, upon construction.
+template <typename T = double> class PulsedStrExp {
+public:
+  /// constructor.
+  PulsedStrExp(T nuclear_lifetime, T pulse_length, T asymmetry, T slr_rate,
+               T beta)
+      : _nuclear_lifetime(nuclear_lifetime), _pulse_length(pulse_length),
+        _asymmetry(asymmetry),
+        _integral(nuclear_lifetime, slr_rate, beta){};
+
+  /// constructor (from the ROOT parameters).
+  explicit PulsedStrExp(const T *par)
+      : PulsedStrExp(par[0], par[1], par[2], par[3], par[4]){};
+
+  /// number of (ROOT) parameters
+  static constexpr unsigned int n_parameters = 5;
+
+  /// Return the asymmetry at a given time.
+  T operator()(T time) const {
+    return pulsed_convolution<T>(time, _nuclear_lifetime, _pulse_length,
+                                 _asymmetry, _integral);
+  };
+
+  /// Return the asymmetry at a given time, and set gradient to its
+  /// derivatives with respect to the (ROOT) parameters.
+  T operator()(T time, T *gradient) const {
+    return pulsed_convolution<2, T>(
+        time, _nuclear_lifetime, _pulse_length, _asymmetry,
+        [this](T a, T b, auto visit) {
+          return _integral.quadrature(a, b, visit);
+        },
+        [this](T u, T *d) { return _integral.integrand(u, d); }, gradient);
+  };
+
+  /// Evaluate the asymmetry at each time.
+  void evaluate(const std::vector<T> &time, std::vector<T> &result) const {
+    pulsed_convolution<T>(time, _nuclear_lifetime, _pulse_length, _asymmetry,
+                          _integral, result);
+  };
+
+private:
+  /// model parameters
+  T _nuclear_lifetime;
+  T _pulse_length;
+  T _asymmetry;
+  /// integral of the pulse's integrand
+  StrExpIntegral<T> _integral;
+};
+
+/// pulsed stretched exponential (for many times at once)
+template <typename T = double>
+void pulsed_str_exp(const std::vector<T> &time, T nuclear_lifetime,
+                    T pulse_length, T asymmetry, T slr_rate, T beta,
+                    std::vector<T> &result) {
+  PulsedStrExp<T>(nuclear_lifetime, pulse_length, asymmetry, slr_rate, beta)
+      .evaluate(time, result);
+}
+
 /// pulsed stretched exponential (ROOT)
 template <typename T = double> T pulsed_str_exp(const T *x, const T *par) {
   return pulsed_str_exp<T>(*x, par[0], par[1], par[2], par[3], par[4]);
@@ -63,4 +259,4 @@ template <typename T = double> T pulsed_str_exp(const T *x, const T *par) {
 
 } // namespace triumf
 
-#endif // TRIUMF_BNMR_SLR_STR_EXP_HPP
\ No newline at end of file
+#endif // TRIUMF_BNMR_SLR_STR_EXP_HPP
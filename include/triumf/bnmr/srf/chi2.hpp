@@ -0,0 +1,125 @@
+#ifndef TRIUMF_BNMR_SRF_CHI2_HPP
+#define TRIUMF_BNMR_SRF_CHI2_HPP
+
+// C++ standard library headers
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+// ROOT headers
+#include <Fit/BinData.h>
+#include <Math/IFunction.h>
+
+// TRIUMF: Canada's particle accelerator centre
+namespace triumf {
+
+// β-detected nuclear magnetic resonance (β-NMR)
+namespace bnmr {
+
+// superconducting radio-frequency (SRF) materials
+namespace srf {
+
+/// \brief Chi^2 of a depth-resolved analyzer against (T, B, E) binned data.
+/// \details Unlike a point-wise model function (i.e., one used by
+/// ROOT::Fit::Chi2Function), the whole dataset is evaluated in one call to
+/// the analyzer's batch interface, such that stopping profiles and the
+/// depth-independent parts of the SLR rate model are computed only once per
+/// unique energy and (temperature, field) pair. The data coordinates must be
+/// ordered as (temperature, applied field, implantation energy). The gradient
+/// is computed by central differences, using two batch evaluations per
+/// parameter. The function can be minimized directly, e.g., with
+/// ROOT::Fit::Fitter::FitFCN.
+template <typename Analyzer, typename Parameters>
+class BatchChi2Function : public ROOT::Math::IMultiGradFunction {
+public:
+  /// function mapping the fit parameters onto the analyzer's parameters
+  using parameter_map = std::function<Parameters(const double *)>;
+
+  /// constructor.
+  BatchChi2Function(const Analyzer &analyzer, const ROOT::Fit::BinData &data,
+                    unsigned int n_parameters, parameter_map map_parameters)
+      : _analyzer(analyzer), _n_parameters(n_parameters),
+        _map_parameters(map_parameters) {
+    if (data.NDim() != 3) {
+      throw std::invalid_argument(
+          "triumf::bnmr::srf::BatchChi2Function: data must have coordinates "
+          "(temperature, applied field, energy)");
+    }
+    const unsigned int n = data.Size();
+    _temperatures.reserve(n);
+    _applied_fields.reserve(n);
+    _energies.reserve(n);
+    _values.reserve(n);
+    _inverse_errors.reserve(n);
+    for (unsigned int i = 0; i < n; ++i) {
+      const double *x = data.Coords(i);
+      _temperatures.push_back(x[0]);
+      _applied_fields.push_back(x[1]);
+      _energies.push_back(x[2]);
+      _values.push_back(data.Value(i));
+      _inverse_errors.push_back(data.InvError(i));
+    }
+  };
+
+  /// Return a copy (required by ROOT).
+  BatchChi2Function *Clone() const override {
+    return new BatchChi2Function(*this);
+  };
+
+  /// Return the number of fit parameters.
+  unsigned int NDim() const override { return _n_parameters; };
+
+  /// Return the number of data points.
+  unsigned int NPoints() const { return _values.size(); };
+
+private:
+  /// chi^2 for a given set of fit parameters
+  double DoEval(const double *par) const override {
+    std::vector<double> rates;
+    _analyzer(_temperatures, _applied_fields, _energies, _map_parameters(par),
+              rates);
+    double chi2 = 0.0;
+    for (std::size_t i = 0; i < rates.size(); ++i) {
+      const double residual = (_values[i] - rates[i]) * _inverse_errors[i];
+      chi2 += residual * residual;
+    }
+    return chi2;
+  };
+
+  /// central difference estimate of d(chi^2)/d(par[i])
+  double DoDerivative(const double *par, unsigned int i) const override {
+    std::vector<double> p(par, par + _n_parameters);
+    const double h =
+        std::cbrt(std::numeric_limits<double>::epsilon()) *
+        std::max(1.0, std::abs(p[i]));
+    p[i] = par[i] + h;
+    const double chi2_plus = DoEval(p.data());
+    p[i] = par[i] - h;
+    const double chi2_minus = DoEval(p.data());
+    return (chi2_plus - chi2_minus) / (2.0 * h);
+  };
+
+  /// the depth-resolved analyzer (must outlive this object)
+  const Analyzer &_analyzer;
+  /// number of fit parameters
+  unsigned int _n_parameters;
+  /// mapping from fit parameters to the analyzer's parameters
+  parameter_map _map_parameters;
+  /// data coordinates, values & (inverse) uncertainties
+  std::vector<double> _temperatures;
+  std::vector<double> _applied_fields;
+  std::vector<double> _energies;
+  std::vector<double> _values;
+  std::vector<double> _inverse_errors;
+};
+
+} // namespace srf
+
+} // namespace bnmr
+
+} // namespace triumf
+
+#endif // TRIUMF_BNMR_SRF_CHI2_HPP
@@ -9,11 +9,12 @@
 #include <vector>
 
 // Boost headers
-#include <boost/math/interpolators/pchip.hpp>
 #include <boost/math/quadrature/tanh_sinh.hpp>
 
 // triumf++ headers
 #include <triumf/bnmr/nuclei.hpp>
+#include <triumf/bnmr/srf/stopping_profile.hpp>
+#include <triumf/instrumentation.hpp>
 #include <triumf/math/pdf.hpp>
 #include <triumf/nmr/dipole_dipole.hpp>
 #include <triumf/nmr/nuclei.hpp>
@@ -46,11 +47,13 @@ T slr_rate_z(T z, T temperature, T critical_temperature, T lambda_0, T exponent,
              T applied_field, T dipole_field, T correlation_rate,
              T slr_constant, T slr_exponent, T surface_thickness,
              T surface_rate) {
+  using std::exp;
+  using std::pow;
   // correct for the field-dependence to the critical temperature
   // https://doi.org/10.1103/PhysRevB.2.3545
   // https://doi.org/10.1016/j.nima.2004.09.003
   // https://doi.org/10.1088/0953-2048/25/6/065014
-  constexpr T Nb_B_c2 = 0.425; // T
+  const T Nb_B_c2 = 0.425; // T
   T corrected_critical_temperature =
       triumf::superconductivity::phenomenology::critical_temperature<T>(
           applied_field, critical_temperature, Nb_B_c2, 0.5);
@@ -64,14 +67,14 @@ T slr_rate_z(T z, T temperature, T critical_temperature, T lambda_0, T exponent,
         temperature, corrected_critical_temperature, exponent, lambda_0);
     T screened_field = temperature > corrected_critical_temperature
                            ? applied_field
-                           : applied_field * std::exp(-1.0 * _z_ / lambda);
+                           : applied_field * exp(-1.0 * _z_ / lambda);
     // calculate the dipole-dipole SLR rate in the superconducting state
     T dd_rate = triumf::nmr::dipole_dipole::slr_rate<T>(
         screened_field, dipole_field, correlation_rate,
         triumf::bnmr::nuclei::lithium_8<T>::gyromagnetic_ratio(),
         triumf::nmr::nuclei::niobium_93<T>::gyromagnetic_ratio());
     // calculate the SLR rate in the normal state
-    T ns_rate = slr_constant * std::pow(temperature, slr_exponent);
+    T ns_rate = slr_constant * pow(temperature, slr_exponent);
     // return the "surface" contribution at shallow depths
     return dd_rate + ns_rate;
   }
@@ -84,11 +87,13 @@ T slr_rate_nss_z(T z, T temperature, T critical_temperature, T lambda_0,
                  T exponent, T applied_field, T dipole_field,
                  T correlation_rate, T slr_constant, T slr_exponent,
                  T surface_thickness) {
+  using std::exp;
+  using std::pow;
   // correct for the field-dependence to the critical temperature
   // https://doi.org/10.1103/PhysRevB.2.3545
   // https://doi.org/10.1016/j.nima.2004.09.003
   // https://doi.org/10.1088/0953-2048/25/6/065014
-  constexpr T Nb_B_c2 = 0.425; // T
+  const T Nb_B_c2 = 0.425; // T
   T corrected_critical_temperature =
       triumf::superconductivity::phenomenology::critical_temperature<T>(
           applied_field, critical_temperature, Nb_B_c2, 0.5);
@@ -101,7 +106,7 @@ T slr_rate_nss_z(T z, T temperature, T critical_temperature, T lambda_0,
         triumf::bnmr::nuclei::lithium_8<T>::gyromagnetic_ratio(),
         triumf::nmr::nuclei::niobium_93<T>::gyromagnetic_ratio());
     // calculate the SLR rate in the normal state
-    T ns_rate_surf = slr_constant * std::pow(temperature, slr_exponent);
+    T ns_rate_surf = slr_constant * pow(temperature, slr_exponent);
     // return the "surface" contribution at shallow depths
     return dd_rate_surf + ns_rate_surf;
   } else {
@@ -110,14 +115,14 @@ T slr_rate_nss_z(T z, T temperature, T critical_temperature, T lambda_0,
         temperature, corrected_critical_temperature, exponent, lambda_0);
     T screened_field = temperature > corrected_critical_temperature
                            ? applied_field
-                           : applied_field * std::exp(-1.0 * _z_ / lambda);
+                           : applied_field * exp(-1.0 * _z_ / lambda);
     // calculate the dipole-dipole SLR rate in the superconducting state
     T dd_rate = triumf::nmr::dipole_dipole::slr_rate<T>(
         screened_field, dipole_field, correlation_rate,
         triumf::bnmr::nuclei::lithium_8<T>::gyromagnetic_ratio(),
         triumf::nmr::nuclei::niobium_93<T>::gyromagnetic_ratio());
     // calculate the SLR rate in the normal state
-    T ns_rate = slr_constant * std::pow(temperature, slr_exponent);
+    T ns_rate = slr_constant * pow(temperature, slr_exponent);
     // return the "surface" contribution at shallow depths
     return dd_rate + ns_rate;
   }
@@ -130,11 +135,13 @@ T slr_rate_film_z(T z, T temperature, T critical_temperature, T lambda_0,
                   T exponent, T applied_field, T dipole_field,
                   T correlation_rate, T slr_constant, T slr_exponent,
                   T surface_thickness, T surface_rate, T film_thickness) {
+  using std::cosh;
+  using std::pow;
   // correct for the field-dependence to the critical temperature
   // https://doi.org/10.1103/PhysRevB.2.3545
   // https://doi.org/10.1016/j.nima.2004.09.003
   // https://doi.org/10.1088/0953-2048/25/6/065014
-  constexpr T Nb_B_c2 = 0.425; // T
+  const T Nb_B_c2 = 0.425; // T
   T corrected_critical_temperature =
       triumf::superconductivity::phenomenology::critical_temperature<T>(
           applied_field, critical_temperature, Nb_B_c2, 0.5);
@@ -151,15 +158,15 @@ T slr_rate_film_z(T z, T temperature, T critical_temperature, T lambda_0,
     T screened_field = temperature > corrected_critical_temperature
                            ? applied_field
                            : applied_field *
-                                 std::cosh((0.5 * _d_ - _z_) / lambda) /
-                                 std::cosh(0.5 * _d_ / lambda);
+                                 cosh((0.5 * _d_ - _z_) / lambda) /
+                                 cosh(0.5 * _d_ / lambda);
     // calculate the dipole-dipole SLR rate in the superconducting state
     T dd_rate = triumf::nmr::dipole_dipole::slr_rate<T>(
         screened_field, dipole_field, correlation_rate,
         triumf::bnmr::nuclei::lithium_8<T>::gyromagnetic_ratio(),
         triumf::nmr::nuclei::niobium_93<T>::gyromagnetic_ratio());
     // calculate the SLR rate in the normal state
-    T ns_rate = slr_constant * std::pow(temperature, slr_exponent);
+    T ns_rate = slr_constant * pow(temperature, slr_exponent);
     // return the "surface" contribution at shallow depths
     return dd_rate + ns_rate;
   }
@@ -172,11 +179,13 @@ T slr_rate_film_nss_z(T z, T temperature, T critical_temperature, T lambda_0,
                       T exponent, T applied_field, T dipole_field,
                       T correlation_rate, T slr_constant, T slr_exponent,
                       T surface_thickness, T film_thickness) {
+  using std::cosh;
+  using std::pow;
   // correct for the field-dependence to the critical temperature
   // https://doi.org/10.1103/PhysRevB.2.3545
   // https://doi.org/10.1016/j.nima.2004.09.003
   // https://doi.org/10.1088/0953-2048/25/6/065014
-  constexpr T Nb_B_c2 = 0.425; // T
+  const T Nb_B_c2 = 0.425; // T
   T corrected_critical_temperature =
       triumf::superconductivity::phenomenology::critical_temperature<T>(
           applied_field, critical_temperature, Nb_B_c2, 0.5);
@@ -191,7 +200,7 @@ T slr_rate_film_nss_z(T z, T temperature, T critical_temperature, T lambda_0,
         triumf::bnmr::nuclei::lithium_8<T>::gyromagnetic_ratio(),
         triumf::nmr::nuclei::niobium_93<T>::gyromagnetic_ratio());
     // calculate the SLR rate in the normal state
-    T ns_rate_surf = slr_constant * std::pow(temperature, slr_exponent);
+    T ns_rate_surf = slr_constant * pow(temperature, slr_exponent);
     // return the "surface" contribution at shallow depths
     return dd_rate_surf + ns_rate_surf;
   } else {
@@ -201,29 +210,175 @@ T slr_rate_film_nss_z(T z, T temperature, T critical_temperature, T lambda_0,
     T screened_field = temperature > corrected_critical_temperature
                            ? applied_field
                            : applied_field *
-                                 std::cosh((0.5 * _d_ - _z_) / lambda) /
-                                 std::cosh(0.5 * _d_ / lambda);
+                                 cosh((0.5 * _d_ - _z_) / lambda) /
+                                 cosh(0.5 * _d_ / lambda);
     // calculate the dipole-dipole SLR rate in the superconducting state
     T dd_rate = triumf::nmr::dipole_dipole::slr_rate<T>(
         screened_field, dipole_field, correlation_rate,
         triumf::bnmr::nuclei::lithium_8<T>::gyromagnetic_ratio(),
         triumf::nmr::nuclei::niobium_93<T>::gyromagnetic_ratio());
     // calculate the SLR rate in the normal state
-    T ns_rate = slr_constant * std::pow(temperature, slr_exponent);
+    T ns_rate = slr_constant * pow(temperature, slr_exponent);
     // return the "surface" contribution at shallow depths
     return dd_rate + ns_rate;
   }
 }
 
+/// \brief Model parameters for the depth-resolved analyzers.
+/// \details Passed (by const reference) to the reentrant evaluation methods,
+/// which makes them safe to call concurrently from several threads (e.g.,
+/// during a ROOT::Fit::ExecutionPolicy::kMultithread fit).
+template <typename T = double> struct Parameters {
+  T temperature = 2.5;
+  T critical_temperature = 9.25;
+  T lambda_0 = 40.0;
+  T exponent = 4.0;
+  T applied_field = 0.02;
+  T dipole_field = 1e-5;
+  T correlation_rate = 1.0 / 23.8e-6;
+  T slr_constant = 0.75;
+  T slr_exponent = 1.0;
+  T surface_thickness = 5.0;
+  T surface_rate = 10.0;
+  T film_thickness = 300.0;
+};
+
+/// \brief SLR rate models at a fixed temperature and applied field.
+/// \details All of the depth-independent quantities (e.g., the field-corrected
+/// critical temperature and the magnetic penetration depth) are computed once
+/// upon construction. The member functions return the same values as their
+/// free function counterparts (e.g., slr_rate_z), but only evaluate the
+/// depth-dependent terms.
+template <typename T = double> class SlrRateModel {
+public:
+  /// constructor.
+  SlrRateModel(const Parameters<T> &parameters)
+      : SlrRateModel(parameters.temperature, parameters.applied_field,
+                     parameters){};
+
+  /// constructor (temperature and field taken separately from the parameters).
+  SlrRateModel(T temperature, T applied_field, const Parameters<T> &parameters)
+      : _parameters(parameters) {
+    using std::cosh;
+    using std::pow;
+    _parameters.temperature = temperature;
+    _parameters.applied_field = applied_field;
+    // correct for the field-dependence to the critical temperature
+    // https://doi.org/10.1103/PhysRevB.2.3545
+    // https://doi.org/10.1016/j.nima.2004.09.003
+    // https://doi.org/10.1088/0953-2048/25/6/065014
+    const T Nb_B_c2 = 0.425; // T
+    _corrected_critical_temperature =
+        triumf::superconductivity::phenomenology::critical_temperature<T>(
+            applied_field, _parameters.critical_temperature, Nb_B_c2, 0.5);
+    _superconducting = not(temperature > _corrected_critical_temperature);
+    // the magnetic penetration depth
+    _lambda = triumf::superconductivity::phenomenology::penetration_depth(
+        temperature, _corrected_critical_temperature, _parameters.exponent,
+        _parameters.lambda_0);
+    // the (half) film thickness, corrected for the surface layer
+    _d_ = 0.5 * (_parameters.film_thickness - _parameters.surface_thickness);
+    _cosh_d_ = cosh(0.5 * _d_ / _lambda);
+    // the SLR rate in the normal state
+    _ns_rate = _parameters.slr_constant *
+               pow(_parameters.temperature, _parameters.slr_exponent);
+    // the SLR rate in the normal state surface layer
+    _nss_rate = dd_rate(applied_field) + _ns_rate;
+  };
+
+  /// The field-corrected critical temperature.
+  T corrected_critical_temperature() const {
+    return _corrected_critical_temperature;
+  };
+
+  /// The magnetic penetration depth.
+  T lambda() const { return _lambda; };
+
+  /// Model SLR rate (see slr_rate_z).
+  T slr_rate_z(T z) const {
+    using std::exp;
+    T _z_ = z - _parameters.surface_thickness;
+    if (_z_ < 0.0) {
+      return _parameters.surface_rate;
+    } else {
+      T screened_field = _superconducting ? _parameters.applied_field *
+                                                exp(-1.0 * _z_ / _lambda)
+                                          : _parameters.applied_field;
+      return dd_rate(screened_field) + _ns_rate;
+    }
+  };
+
+  /// Model SLR rate (see slr_rate_nss_z).
+  T slr_rate_nss_z(T z) const {
+    using std::exp;
+    T _z_ = z - _parameters.surface_thickness;
+    if (_z_ < 0.0) {
+      return _nss_rate;
+    } else {
+      T screened_field = _superconducting ? _parameters.applied_field *
+                                                exp(-1.0 * _z_ / _lambda)
+                                          : _parameters.applied_field;
+      return dd_rate(screened_field) + _ns_rate;
+    }
+  };
+
+  /// Model SLR rate for a thin film (see slr_rate_film_z).
+  T slr_rate_film_z(T z) const {
+    T _z_ = z - _parameters.surface_thickness;
+    if (_z_ < 0.0) {
+      return _parameters.surface_rate;
+    } else {
+      return dd_rate(film_screened_field(_z_)) + _ns_rate;
+    }
+  };
+
+  /// Model SLR rate for a thin film (see slr_rate_film_nss_z).
+  T slr_rate_film_nss_z(T z) const {
+    T _z_ = z - _parameters.surface_thickness;
+    if (_z_ < 0.0) {
+      return _nss_rate;
+    } else {
+      return dd_rate(film_screened_field(_z_)) + _ns_rate;
+    }
+  };
+
+private:
+  /// dipole-dipole SLR rate for a given (local) field
+  T dd_rate(T field) const {
+    return triumf::nmr::dipole_dipole::slr_rate<T>(
+        field, _parameters.dipole_field, _parameters.correlation_rate,
+        triumf::bnmr::nuclei::lithium_8<T>::gyromagnetic_ratio(),
+        triumf::nmr::nuclei::niobium_93<T>::gyromagnetic_ratio());
+  };
+
+  /// screened field in a thin film (_z_ corrected for the surface layer)
+  T film_screened_field(T _z_) const {
+    using std::cosh;
+    return _superconducting ? _parameters.applied_field *
+                                  cosh((0.5 * _d_ - _z_) / _lambda) /
+                                  _cosh_d_
+                            : _parameters.applied_field;
+  };
+
+  /// model parameters
+  Parameters<T> _parameters;
+  /// precomputed (depth-independent) quantities
+  T _corrected_critical_temperature;
+  bool _superconducting;
+  T _lambda;
+  T _d_;
+  T _cosh_d_;
+  T _ns_rate;
+  T _nss_rate;
+};
+
 /// Depth-resolved analyzer.
 /// For implantation averaging over the SLR model (independent surface rate).
 template <typename T = double> class DepthResolvedAnalyzer {
 public:
   /// constructor.
-  DepthResolvedAnalyzer(const std::string &csv_filename) {
-    // read in the data for the stopping profiles
-    read_csv_data(csv_filename);
-
+  DepthResolvedAnalyzer(const std::string &csv_filename)
+      : _stopping_profile(csv_filename) {
     // default initialized values
     temperature = 2.5;
     critical_temperature = 9.25;
@@ -238,125 +393,130 @@ public:
     surface_rate = 10.0;
   };
 
-  /// Read the CSV data
+  /// Read the CSV data (and build the interpolators).
   void read_csv_data(const std::string &csv_filename) {
-    // read the data into a ROOT DataFrame...
-    auto df = ROOT::RDF::MakeCsvDataFrame(csv_filename);
-    // ...and extract the values
-    _energy = df.Take<T>("Energy (keV)").GetValue();
-    _alpha_1 = df.Take<T>("alpha_1").GetValue();
-    _alpha_1_error = df.Take<T>("alpha_1_error").GetValue();
-    _beta_1 = df.Take<T>("beta_1").GetValue();
-    _beta_1_error = df.Take<T>("beta_1_error").GetValue();
-    _z_max_1 = df.Take<T>("z_max_1").GetValue();
-    _z_max_1_error = df.Take<T>("z_max_1_error").GetValue();
-    _fraction_1 = df.Take<T>("fraction_1").GetValue();
-    _fraction_1_error = df.Take<T>("fraction_1_error").GetValue();
-    _alpha_2 = df.Take<T>("alpha_2").GetValue();
-    _alpha_2_error = df.Take<T>("alpha_2_error").GetValue();
-    _beta_2 = df.Take<T>("beta_2").GetValue();
-    _beta_2_error = df.Take<T>("beta_2_error").GetValue();
-    _z_max_2 = df.Take<T>("z_max_2").GetValue();
-    _z_max_2_error = df.Take<T>("z_max_2_error").GetValue();
+    _stopping_profile.read_csv_data(csv_filename);
+    _quadrature.clear();
   };
 
   /// Return the the minium energy available for interpolation.
-  T energy_min() {
-    return *std::min_element(_energy.begin(), _energy.end()) +
-           std::sqrt(std::numeric_limits<T>::epsilon());
-  };
+  T energy_min() const { return _stopping_profile.energy_min(); };
 
   /// Return the the maximum energy available for interpolation.
-  T energy_max() {
-    return *std::max_element(_energy.begin(), _energy.end()) -
-           std::sqrt(std::numeric_limits<T>::epsilon());
-  };
+  T energy_max() const { return _stopping_profile.energy_max(); };
 
   /// Return an interpolated alpha_1 value.
-  T alpha_1(T energy_keV) {
-    static boost::math::interpolators::pchip<std::vector<T>>
-        alpha_interpolator_1(std::move(std::vector<T>(_energy)),
-                             std::move(std::vector<T>(_alpha_1)));
-    return alpha_interpolator_1(energy_keV);
+  T alpha_1(T energy_keV) const {
+    return _stopping_profile.alpha_1(energy_keV);
   };
 
   /// Return an interpolated alpha_2 value.
-  T alpha_2(T energy_keV) {
-    static boost::math::interpolators::pchip<std::vector<T>>
-        alpha_interpolator_2(std::move(std::vector<T>(_energy)),
-                             std::move(std::vector<T>(_alpha_2)));
-    return alpha_interpolator_2(energy_keV);
+  T alpha_2(T energy_keV) const {
+    return _stopping_profile.alpha_2(energy_keV);
   };
 
   /// Return an interpolated beta_1 value.
-  T beta_1(T energy_keV) {
-    static boost::math::interpolators::pchip<std::vector<T>>
-        beta_interpolator_1(std::move(std::vector<T>(_energy)),
-                            std::move(std::vector<T>(_beta_1)));
-    return beta_interpolator_1(energy_keV);
-  };
+  T beta_1(T energy_keV) const { return _stopping_profile.beta_1(energy_keV); };
 
   /// Return an interpolated beta_2 value.
-  T beta_2(T energy_keV) {
-    static boost::math::interpolators::pchip<std::vector<T>>
-        beta_interpolator_2(std::move(std::vector<T>(_energy)),
-                            std::move(std::vector<T>(_beta_2)));
-    return beta_interpolator_2(energy_keV);
-  };
+  T beta_2(T energy_keV) const { return _stopping_profile.beta_2(energy_keV); };
 
   /// Return an interpolated z_max_1 value.
-  T z_max_1(T energy_keV) {
-    static boost::math::interpolators::pchip<std::vector<T>>
-        z_max_interpolator_1(std::move(std::vector<T>(_energy)),
-                             std::move(std::vector<T>(_z_max_1)));
-    return z_max_interpolator_1(energy_keV);
+  T z_max_1(T energy_keV) const {
+    return _stopping_profile.z_max_1(energy_keV);
   };
 
   /// Return an interpolated z_max_2 value.
-  T z_max_2(T energy_keV) {
-    static boost::math::interpolators::pchip<std::vector<T>>
-        z_max_interpolator_2(std::move(std::vector<T>(_energy)),
-                             std::move(std::vector<T>(_z_max_2)));
-    return z_max_interpolator_2(energy_keV);
+  T z_max_2(T energy_keV) const {
+    return _stopping_profile.z_max_2(energy_keV);
   };
 
   /// Return an interpolated fraction_1 value.
-  T fraction_1(T energy_keV) {
-    static boost::math::interpolators::pchip<std::vector<T>>
-        fraction_interpolator_1(std::move(std::vector<T>(_energy)),
-                                std::move(std::vector<T>(_fraction_1)));
-    return fraction_interpolator_1(energy_keV);
+  T fraction_1(T energy_keV) const {
+    return _stopping_profile.fraction_1(energy_keV);
+  };
+
+  /// Return all of the stopping parameters at a given energy.
+  StoppingProfile<T> stopping_profile(T energy_keV) const {
+    return _stopping_profile(energy_keV);
   };
 
   /// Return the average implantation depth.
-  T z_average(T energy_keV) {
-    T a_1 = alpha_1(energy_keV);
-    T b_1 = beta_1(energy_keV);
-    T zm_1 = z_max_1(energy_keV);
-    T f_1 = fraction_1(energy_keV);
-    T a_2 = alpha_2(energy_keV);
-    T b_2 = beta_2(energy_keV);
-    T zm_2 = z_max_2(energy_keV);
-    return f_1 * zm_1 * a_1 / (a_1 + b_1) +
-           (1.0 - f_1) * zm_2 * a_2 / (a_2 + b_2);
-  };
-
-  /// depth-averaging using numeric integration
-  T operator()(T energy_keV) {
-    static boost::math::quadrature::tanh_sinh<T> integrator;
-    auto integrand = [&](T z) {
-      return slr_rate_z<T>(z, temperature, critical_temperature, lambda_0,
-                           exponent, applied_field, dipole_field,
-                           correlation_rate, slr_constant, slr_exponent,
-                           surface_thickness, surface_rate) *
-             triumf::math::pdf::two_modified_beta<T>(
-                 z, alpha_1(energy_keV), beta_1(energy_keV),
-                 z_max_1(energy_keV), fraction_1(energy_keV),
-                 alpha_2(energy_keV), beta_2(energy_keV), z_max_2(energy_keV));
-    };
-    T z_max = std::max(z_max_1(energy_keV), z_max_2(energy_keV));
-    T Q = integrator.integrate(integrand, 0.0, z_max);
-    return Q;
+  T z_average(T energy_keV) const {
+    return _stopping_profile(energy_keV).z_average();
+  };
+
+  /// depth-averaging using numeric integration (reentrant)
+  T operator()(T energy_keV, const Parameters<T> &parameters) const {
+    return average(_stopping_profile(energy_keV),
+                   SlrRateModel<T>(parameters));
+  };
+
+  /// depth-averaging over many (temperature, field, energy) points at once,
+  /// see triumf::bnmr::srf::depth_average.
+  void operator()(const std::vector<T> &temperatures,
+                  const std::vector<T> &applied_fields,
+                  const std::vector<T> &energies,
+                  const Parameters<T> &parameters,
+                  std::vector<T> &rates) const {
+    depth_average<T, SlrRateModel<T>>(*this, temperatures, applied_fields,
+                                      energies, parameters, rates);
+  };
+
+  /// depth-averaging for a given stopping profile and SLR rate model
+  T average(const StoppingProfile<T> &profile,
+            const SlrRateModel<T> &model) const {
+    // each thread gets its own quadrature workspace
+    static thread_local boost::math::quadrature::tanh_sinh<T> integrator;
+    auto integrand = [&](T z) { return model.slr_rate_z(z) * profile(z); };
+    triumf::instrumentation::Probe<T> probe(
+        "triumf::bnmr::srf::local::DepthResolvedAnalyzer::average");
+    return integrator.integrate(probe.counted(integrand), 0.0,
+                                profile.z_max(),
+                                boost::math::tools::root_epsilon<T>(),
+                                probe.error(), nullptr, probe.levels());
+  };
+
+  /// \brief Depth-averaging using fixed-node Gauss-Jacobi quadrature.
+  /// \details The quadrature rules are cached for each energy (see
+  /// StoppingProfileQuadrature). If error is not null, it is set to an
+  /// estimate of the absolute error.
+  T gauss_jacobi(T energy_keV, const Parameters<T> &parameters,
+                 T *error = nullptr) const {
+    const SlrRateModel<T> model(parameters);
+    return (*_quadrature(energy_keV, _stopping_profile))(
+        [&model](T z) { return model.slr_rate_z(z); },
+        parameters.surface_thickness, error);
+  };
+
+  /// Return the number of Gauss-Jacobi nodes (per profile component).
+  std::size_t gauss_jacobi_nodes() const { return _quadrature.n_nodes(); };
+
+  /// Set the number of Gauss-Jacobi nodes (per profile component).
+  void set_gauss_jacobi_nodes(std::size_t n_nodes) {
+    _quadrature.set_n_nodes(n_nodes);
+  };
+
+  /// depth-averaging using numeric integration (public member parameters)
+  T operator()(T energy_keV) const {
+    return (*this)(energy_keV, parameters());
+  };
+
+  /// Return the public member model parameters as a Parameters struct.
+  Parameters<T> parameters() const {
+    Parameters<T> p;
+    p.temperature = temperature;
+    p.critical_temperature = critical_temperature;
+    p.lambda_0 = lambda_0;
+    p.exponent = exponent;
+    p.applied_field = applied_field;
+    p.dipole_field = dipole_field;
+    p.correlation_rate = correlation_rate;
+    p.slr_constant = slr_constant;
+    p.slr_exponent = slr_exponent;
+    p.surface_thickness = surface_thickness;
+    p.surface_rate = surface_rate;
+    return p;
   };
 
   /// model parameters
@@ -374,22 +534,10 @@ public:
   T electron_phonon_coupling;
 
 private:
-  /// vectors of data from csv file
-  std::vector<T> _energy;
-  std::vector<T> _alpha_1;
-  std::vector<T> _alpha_1_error;
-  std::vector<T> _beta_1;
-  std::vector<T> _beta_1_error;
-  std::vector<T> _z_max_1;
-  std::vector<T> _z_max_1_error;
-  std::vector<T> _fraction_1;
-  std::vector<T> _fraction_1_error;
-  std::vector<T> _alpha_2;
-  std::vector<T> _alpha_2_error;
-  std::vector<T> _beta_2;
-  std::vector<T> _beta_2_error;
-  std::vector<T> _z_max_2;
-  std::vector<T> _z_max_2_error;
+  /// interpolated stopping profile parameters
+  StoppingProfileInterpolator<T> _stopping_profile;
+  /// cached Gauss-Jacobi quadrature rules
+  StoppingProfileQuadratureCache<T> _quadrature;
 };
 
 /// Depth-resolved analyzer.
@@ -397,10 +545,8 @@ private:
 template <typename T = double> class DepthResolvedAnalyzerNSS {
 public:
   /// constructor.
-  DepthResolvedAnalyzerNSS(const std::string &csv_filename) {
-    // read in the data for the stopping profiles
-    read_csv_data(csv_filename);
-
+  DepthResolvedAnalyzerNSS(const std::string &csv_filename)
+      : _stopping_profile(csv_filename) {
     // default initialized values
     temperature = 2.5;
     critical_temperature = 9.25;
@@ -415,125 +561,129 @@ public:
     surface_rate = 10.0;
   };
 
-  /// Read the CSV data
+  /// Read the CSV data (and build the interpolators).
   void read_csv_data(const std::string &csv_filename) {
-    // read the data into a ROOT DataFrame...
-    auto df = ROOT::RDF::MakeCsvDataFrame(csv_filename);
-    // ...and extract the values
-    _energy = df.Take<T>("Energy (keV)").GetValue();
-    _alpha_1 = df.Take<T>("alpha_1").GetValue();
-    _alpha_1_error = df.Take<T>("alpha_1_error").GetValue();
-    _beta_1 = df.Take<T>("beta_1").GetValue();
-    _beta_1_error = df.Take<T>("beta_1_error").GetValue();
-    _z_max_1 = df.Take<T>("z_max_1").GetValue();
-    _z_max_1_error = df.Take<T>("z_max_1_error").GetValue();
-    _fraction_1 = df.Take<T>("fraction_1").GetValue();
-    _fraction_1_error = df.Take<T>("fraction_1_error").GetValue();
-    _alpha_2 = df.Take<T>("alpha_2").GetValue();
-    _alpha_2_error = df.Take<T>("alpha_2_error").GetValue();
-    _beta_2 = df.Take<T>("beta_2").GetValue();
-    _beta_2_error = df.Take<T>("beta_2_error").GetValue();
-    _z_max_2 = df.Take<T>("z_max_2").GetValue();
-    _z_max_2_error = df.Take<T>("z_max_2_error").GetValue();
+    _stopping_profile.read_csv_data(csv_filename);
+    _quadrature.clear();
   };
 
   /// Return the the minium energy available for interpolation.
-  T energy_min() {
-    return *std::min_element(_energy.begin(), _energy.end()) +
-           std::sqrt(std::numeric_limits<T>::epsilon());
-  };
+  T energy_min() const { return _stopping_profile.energy_min(); };
 
   /// Return the the maximum energy available for interpolation.
-  T energy_max() {
-    return *std::max_element(_energy.begin(), _energy.end()) -
-           std::sqrt(std::numeric_limits<T>::epsilon());
-  };
+  T energy_max() const { return _stopping_profile.energy_max(); };
 
   /// Return an interpolated alpha_1 value.
-  T alpha_1(T energy_keV) {
-    static boost::math::interpolators::pchip<std::vector<T>>
-        alpha_interpolator_1(std::move(std::vector<T>(_energy)),
-                             std::move(std::vector<T>(_alpha_1)));
-    return alpha_interpolator_1(energy_keV);
+  T alpha_1(T energy_keV) const {
+    return _stopping_profile.alpha_1(energy_keV);
   };
 
   /// Return an interpolated alpha_2 value.
-  T alpha_2(T energy_keV) {
-    static boost::math::interpolators::pchip<std::vector<T>>
-        alpha_interpolator_2(std::move(std::vector<T>(_energy)),
-                             std::move(std::vector<T>(_alpha_2)));
-    return alpha_interpolator_2(energy_keV);
+  T alpha_2(T energy_keV) const {
+    return _stopping_profile.alpha_2(energy_keV);
   };
 
   /// Return an interpolated beta_1 value.
-  T beta_1(T energy_keV) {
-    static boost::math::interpolators::pchip<std::vector<T>>
-        beta_interpolator_1(std::move(std::vector<T>(_energy)),
-                            std::move(std::vector<T>(_beta_1)));
-    return beta_interpolator_1(energy_keV);
-  };
+  T beta_1(T energy_keV) const { return _stopping_profile.beta_1(energy_keV); };
 
   /// Return an interpolated beta_2 value.
-  T beta_2(T energy_keV) {
-    static boost::math::interpolators::pchip<std::vector<T>>
-        beta_interpolator_2(std::move(std::vector<T>(_energy)),
-                            std::move(std::vector<T>(_beta_2)));
-    return beta_interpolator_2(energy_keV);
-  };
+  T beta_2(T energy_keV) const { return _stopping_profile.beta_2(energy_keV); };
 
   /// Return an interpolated z_max_1 value.
-  T z_max_1(T energy_keV) {
-    static boost::math::interpolators::pchip<std::vector<T>>
-        z_max_interpolator_1(std::move(std::vector<T>(_energy)),
-                             std::move(std::vector<T>(_z_max_1)));
-    return z_max_interpolator_1(energy_keV);
+  T z_max_1(T energy_keV) const {
+    return _stopping_profile.z_max_1(energy_keV);
   };
 
   /// Return an interpolated z_max_2 value.
-  T z_max_2(T energy_keV) {
-    static boost::math::interpolators::pchip<std::vector<T>>
-        z_max_interpolator_2(std::move(std::vector<T>(_energy)),
-                             std::move(std::vector<T>(_z_max_2)));
-    return z_max_interpolator_2(energy_keV);
+  T z_max_2(T energy_keV) const {
+    return _stopping_profile.z_max_2(energy_keV);
   };
 
   /// Return an interpolated fraction_1 value.
-  T fraction_1(T energy_keV) {
-    static boost::math::interpolators::pchip<std::vector<T>>
-        fraction_interpolator_1(std::move(std::vector<T>(_energy)),
-                                std::move(std::vector<T>(_fraction_1)));
-    return fraction_interpolator_1(energy_keV);
+  T fraction_1(T energy_keV) const {
+    return _stopping_profile.fraction_1(energy_keV);
+  };
+
+  /// Return all of the stopping parameters at a given energy.
+  StoppingProfile<T> stopping_profile(T energy_keV) const {
+    return _stopping_profile(energy_keV);
   };
 
   /// Return the average implantation depth.
-  T z_average(T energy_keV) {
-    T a_1 = alpha_1(energy_keV);
-    T b_1 = beta_1(energy_keV);
-    T zm_1 = z_max_1(energy_keV);
-    T f_1 = fraction_1(energy_keV);
-    T a_2 = alpha_2(energy_keV);
-    T b_2 = beta_2(energy_keV);
-    T zm_2 = z_max_2(energy_keV);
-    return f_1 * zm_1 * a_1 / (a_1 + b_1) +
-           (1.0 - f_1) * zm_2 * a_2 / (a_2 + b_2);
-  };
-
-  /// depth-averaging using numeric integration
-  T operator()(T energy_keV) {
-    static boost::math::quadrature::tanh_sinh<T> integrator;
-    auto integrand = [&](T z) {
-      return slr_rate_nss_z<T>(z, temperature, critical_temperature, lambda_0,
-                               exponent, applied_field, dipole_field,
-                               correlation_rate, slr_constant, slr_exponent,
-                               surface_thickness) *
-             triumf::math::pdf::two_modified_beta<T>(
-                 z, alpha_1(energy_keV), beta_1(energy_keV),
-                 z_max_1(energy_keV), fraction_1(energy_keV),
-                 alpha_2(energy_keV), beta_2(energy_keV), z_max_2(energy_keV));
-    };
-    T z_max = std::max(z_max_1(energy_keV), z_max_2(energy_keV));
-    T Q = integrator.integrate(integrand, 0.0, z_max);
-    return Q;
+  T z_average(T energy_keV) const {
+    return _stopping_profile(energy_keV).z_average();
+  };
+
+  /// depth-averaging using numeric integration (reentrant)
+  T operator()(T energy_keV, const Parameters<T> &parameters) const {
+    return average(_stopping_profile(energy_keV),
+                   SlrRateModel<T>(parameters));
+  };
+
+  /// depth-averaging over many (temperature, field, energy) points at once,
+  /// see triumf::bnmr::srf::depth_average.
+  void operator()(const std::vector<T> &temperatures,
+                  const std::vector<T> &applied_fields,
+                  const std::vector<T> &energies,
+                  const Parameters<T> &parameters,
+                  std::vector<T> &rates) const {
+    depth_average<T, SlrRateModel<T>>(*this, temperatures, applied_fields,
+                                      energies, parameters, rates);
+  };
+
+  /// depth-averaging for a given stopping profile and SLR rate model
+  T average(const StoppingProfile<T> &profile,
+            const SlrRateModel<T> &model) const {
+    // each thread gets its own quadrature workspace
+    static thread_local boost::math::quadrature::tanh_sinh<T> integrator;
+    auto integrand = [&](T z) { return model.slr_rate_nss_z(z) * profile(z); };
+    triumf::instrumentation::Probe<T> probe(
+        "triumf::bnmr::srf::local::DepthResolvedAnalyzerNSS::average");
+    return integrator.integrate(probe.counted(integrand), 0.0,
+                                profile.z_max(),
+                                boost::math::tools::root_epsilon<T>(),
+                                probe.error(), nullptr, probe.levels());
+  };
+
+  /// \brief Depth-averaging using fixed-node Gauss-Jacobi quadrature.
+  /// \details The quadrature rules are cached for each energy (see
+  /// StoppingProfileQuadrature). If error is not null, it is set to an
+  /// estimate of the absolute error.
+  T gauss_jacobi(T energy_keV, const Parameters<T> &parameters,
+                 T *error = nullptr) const {
+    const SlrRateModel<T> model(parameters);
+    return (*_quadrature(energy_keV, _stopping_profile))(
+        [&model](T z) { return model.slr_rate_nss_z(z); },
+        parameters.surface_thickness, error);
+  };
+
+  /// Return the number of Gauss-Jacobi nodes (per profile component).
+  std::size_t gauss_jacobi_nodes() const { return _quadrature.n_nodes(); };
+
+  /// Set the number of Gauss-Jacobi nodes (per profile component).
+  void set_gauss_jacobi_nodes(std::size_t n_nodes) {
+    _quadrature.set_n_nodes(n_nodes);
+  };
+
+  /// depth-averaging using numeric integration (public member parameters)
+  T operator()(T energy_keV) const {
+    return (*this)(energy_keV, parameters());
+  };
+
+  /// Return the public member model parameters as a Parameters struct.
+  Parameters<T> parameters() const {
+    Parameters<T> p;
+    p.temperature = temperature;
+    p.critical_temperature = critical_temperature;
+    p.lambda_0 = lambda_0;
+    p.exponent = exponent;
+    p.applied_field = applied_field;
+    p.dipole_field = dipole_field;
+    p.correlation_rate = correlation_rate;
+    p.slr_constant = slr_constant;
+    p.slr_exponent = slr_exponent;
+    p.surface_thickness = surface_thickness;
+    return p;
   };
 
   /// model parameters
@@ -551,22 +701,10 @@ public:
   T electron_phonon_coupling;
 
 private:
-  /// vectors of data from csv file
-  std::vector<T> _energy;
-  std::vector<T> _alpha_1;
-  std::vector<T> _alpha_1_error;
-  std::vector<T> _beta_1;
-  std::vector<T> _beta_1_error;
-  std::vector<T> _z_max_1;
-  std::vector<T> _z_max_1_error;
-  std::vector<T> _fraction_1;
-  std::vector<T> _fraction_1_error;
-  std::vector<T> _alpha_2;
-  std::vector<T> _alpha_2_error;
-  std::vector<T> _beta_2;
-  std::vector<T> _beta_2_error;
-  std::vector<T> _z_max_2;
-  std::vector<T> _z_max_2_error;
+  /// interpolated stopping profile parameters
+  StoppingProfileInterpolator<T> _stopping_profile;
+  /// cached Gauss-Jacobi quadrature rules
+  StoppingProfileQuadratureCache<T> _quadrature;
 };
 
 /// Depth-resolved analyzer for thin films.
@@ -574,10 +712,8 @@ private:
 template <typename T = double> class DepthResolvedFilmAnalyzer {
 public:
   /// constructor.
-  DepthResolvedFilmAnalyzer(const std::string &csv_filename) {
-    // read in the data for the stopping profiles
-    read_csv_data(csv_filename);
-
+  DepthResolvedFilmAnalyzer(const std::string &csv_filename)
+      : _stopping_profile(csv_filename) {
     // default initialized values
     temperature = 2.5;
     critical_temperature = 9.25;
@@ -593,126 +729,131 @@ public:
     film_thickness = 300.0;
   };
 
-  /// Read the CSV data
+  /// Read the CSV data (and build the interpolators).
   void read_csv_data(const std::string &csv_filename) {
-    // read the data into a ROOT DataFrame...
-    auto df = ROOT::RDF::MakeCsvDataFrame(csv_filename);
-    // ...and extract the values
-    _energy = df.Take<T>("Energy (keV)").GetValue();
-    _alpha_1 = df.Take<T>("alpha_1").GetValue();
-    _alpha_1_error = df.Take<T>("alpha_1_error").GetValue();
-    _beta_1 = df.Take<T>("beta_1").GetValue();
-    _beta_1_error = df.Take<T>("beta_1_error").GetValue();
-    _z_max_1 = df.Take<T>("z_max_1").GetValue();
-    _z_max_1_error = df.Take<T>("z_max_1_error").GetValue();
-    _fraction_1 = df.Take<T>("fraction_1").GetValue();
-    _fraction_1_error = df.Take<T>("fraction_1_error").GetValue();
-    _alpha_2 = df.Take<T>("alpha_2").GetValue();
-    _alpha_2_error = df.Take<T>("alpha_2_error").GetValue();
-    _beta_2 = df.Take<T>("beta_2").GetValue();
-    _beta_2_error = df.Take<T>("beta_2_error").GetValue();
-    _z_max_2 = df.Take<T>("z_max_2").GetValue();
-    _z_max_2_error = df.Take<T>("z_max_2_error").GetValue();
+    _stopping_profile.read_csv_data(csv_filename);
+    _quadrature.clear();
   };
 
   /// Return the the minium energy available for interpolation.
-  T energy_min() {
-    return *std::min_element(_energy.begin(), _energy.end()) +
-           std::sqrt(std::numeric_limits<T>::epsilon());
-  };
+  T energy_min() const { return _stopping_profile.energy_min(); };
 
   /// Return the the maximum energy available for interpolation.
-  T energy_max() {
-    return *std::max_element(_energy.begin(), _energy.end()) -
-           std::sqrt(std::numeric_limits<T>::epsilon());
-  };
+  T energy_max() const { return _stopping_profile.energy_max(); };
 
   /// Return an interpolated alpha_1 value.
-  T alpha_1(T energy_keV) {
-    static boost::math::interpolators::pchip<std::vector<T>>
-        alpha_interpolator_1(std::move(std::vector<T>(_energy)),
-                             std::move(std::vector<T>(_alpha_1)));
-    return alpha_interpolator_1(energy_keV);
+  T alpha_1(T energy_keV) const {
+    return _stopping_profile.alpha_1(energy_keV);
   };
 
   /// Return an interpolated alpha_2 value.
-  T alpha_2(T energy_keV) {
-    static boost::math::interpolators::pchip<std::vector<T>>
-        alpha_interpolator_2(std::move(std::vector<T>(_energy)),
-                             std::move(std::vector<T>(_alpha_2)));
-    return alpha_interpolator_2(energy_keV);
+  T alpha_2(T energy_keV) const {
+    return _stopping_profile.alpha_2(energy_keV);
   };
 
   /// Return an interpolated beta_1 value.
-  T beta_1(T energy_keV) {
-    static boost::math::interpolators::pchip<std::vector<T>>
-        beta_interpolator_1(std::move(std::vector<T>(_energy)),
-                            std::move(std::vector<T>(_beta_1)));
-    return beta_interpolator_1(energy_keV);
-  };
+  T beta_1(T energy_keV) const { return _stopping_profile.beta_1(energy_keV); };
 
   /// Return an interpolated beta_2 value.
-  T beta_2(T energy_keV) {
-    static boost::math::interpolators::pchip<std::vector<T>>
-        beta_interpolator_2(std::move(std::vector<T>(_energy)),
-                            std::move(std::vector<T>(_beta_2)));
-    return beta_interpolator_2(energy_keV);
-  };
+  T beta_2(T energy_keV) const { return _stopping_profile.beta_2(energy_keV); };
 
   /// Return an interpolated z_max_1 value.
-  T z_max_1(T energy_keV) {
-    static boost::math::interpolators::pchip<std::vector<T>>
-        z_max_interpolator_1(std::move(std::vector<T>(_energy)),
-                             std::move(std::vector<T>(_z_max_1)));
-    return z_max_interpolator_1(energy_keV);
+  T z_max_1(T energy_keV) const {
+    return _stopping_profile.z_max_1(energy_keV);
   };
 
   /// Return an interpolated z_max_2 value.
-  T z_max_2(T energy_keV) {
-    static boost::math::interpolators::pchip<std::vector<T>>
-        z_max_interpolator_2(std::move(std::vector<T>(_energy)),
-                             std::move(std::vector<T>(_z_max_2)));
-    return z_max_interpolator_2(energy_keV);
+  T z_max_2(T energy_keV) const {
+    return _stopping_profile.z_max_2(energy_keV);
   };
 
   /// Return an interpolated fraction_1 value.
-  T fraction_1(T energy_keV) {
-    static boost::math::interpolators::pchip<std::vector<T>>
-        fraction_interpolator_1(std::move(std::vector<T>(_energy)),
-                                std::move(std::vector<T>(_fraction_1)));
-    return fraction_interpolator_1(energy_keV);
+  T fraction_1(T energy_keV) const {
+    return _stopping_profile.fraction_1(energy_keV);
+  };
+
+  /// Return all of the stopping parameters at a given energy.
+  StoppingProfile<T> stopping_profile(T energy_keV) const {
+    return _stopping_profile(energy_keV);
   };
 
   /// Return the average implantation depth.
-  T z_average(T energy_keV) {
-    T a_1 = alpha_1(energy_keV);
-    T b_1 = beta_1(energy_keV);
-    T zm_1 = z_max_1(energy_keV);
-    T f_1 = fraction_1(energy_keV);
-    T a_2 = alpha_2(energy_keV);
-    T b_2 = beta_2(energy_keV);
-    T zm_2 = z_max_2(energy_keV);
-    return f_1 * zm_1 * a_1 / (a_1 + b_1) +
-           (1.0 - f_1) * zm_2 * a_2 / (a_2 + b_2);
-  };
-
-  /// depth-averaging using numeric integration
-  T operator()(T energy_keV) {
-    static boost::math::quadrature::tanh_sinh<T> integrator;
-    auto integrand = [&](T z) {
-      return slr_rate_film_z<T>(z, temperature, critical_temperature, lambda_0,
-                                exponent, applied_field, dipole_field,
-                                correlation_rate, slr_constant, slr_exponent,
-                                surface_thickness, surface_rate,
-                                film_thickness) *
-             triumf::math::pdf::two_modified_beta<T>(
-                 z, alpha_1(energy_keV), beta_1(energy_keV),
-                 z_max_1(energy_keV), fraction_1(energy_keV),
-                 alpha_2(energy_keV), beta_2(energy_keV), z_max_2(energy_keV));
-    };
-    T z_max = std::max(z_max_1(energy_keV), z_max_2(energy_keV));
-    T Q = integrator.integrate(integrand, 0.0, z_max);
-    return Q;
+  T z_average(T energy_keV) const {
+    return _stopping_profile(energy_keV).z_average();
+  };
+
+  /// depth-averaging using numeric integration (reentrant)
+  T operator()(T energy_keV, const Parameters<T> &parameters) const {
+    return average(_stopping_profile(energy_keV),
+                   SlrRateModel<T>(parameters));
+  };
+
+  /// depth-averaging over many (temperature, field, energy) points at once,
+  /// see triumf::bnmr::srf::depth_average.
+  void operator()(const std::vector<T> &temperatures,
+                  const std::vector<T> &applied_fields,
+                  const std::vector<T> &energies,
+                  const Parameters<T> &parameters,
+                  std::vector<T> &rates) const {
+    depth_average<T, SlrRateModel<T>>(*this, temperatures, applied_fields,
+                                      energies, parameters, rates);
+  };
+
+  /// depth-averaging for a given stopping profile and SLR rate model
+  T average(const StoppingProfile<T> &profile,
+            const SlrRateModel<T> &model) const {
+    // each thread gets its own quadrature workspace
+    static thread_local boost::math::quadrature::tanh_sinh<T> integrator;
+    auto integrand = [&](T z) { return model.slr_rate_film_z(z) * profile(z); };
+    triumf::instrumentation::Probe<T> probe(
+        "triumf::bnmr::srf::local::DepthResolvedFilmAnalyzer::average");
+    return integrator.integrate(probe.counted(integrand), 0.0,
+                                profile.z_max(),
+                                boost::math::tools::root_epsilon<T>(),
+                                probe.error(), nullptr, probe.levels());
+  };
+
+  /// \brief Depth-averaging using fixed-node Gauss-Jacobi quadrature.
+  /// \details The quadrature rules are cached for each energy (see
+  /// StoppingProfileQuadrature). If error is not null, it is set to an
+  /// estimate of the absolute error.
+  T gauss_jacobi(T energy_keV, const Parameters<T> &parameters,
+                 T *error = nullptr) const {
+    const SlrRateModel<T> model(parameters);
+    return (*_quadrature(energy_keV, _stopping_profile))(
+        [&model](T z) { return model.slr_rate_film_z(z); },
+        parameters.surface_thickness, error);
+  };
+
+  /// Return the number of Gauss-Jacobi nodes (per profile component).
+  std::size_t gauss_jacobi_nodes() const { return _quadrature.n_nodes(); };
+
+  /// Set the number of Gauss-Jacobi nodes (per profile component).
+  void set_gauss_jacobi_nodes(std::size_t n_nodes) {
+    _quadrature.set_n_nodes(n_nodes);
+  };
+
+  /// depth-averaging using numeric integration (public member parameters)
+  T operator()(T energy_keV) const {
+    return (*this)(energy_keV, parameters());
+  };
+
+  /// Return the public member model parameters as a Parameters struct.
+  Parameters<T> parameters() const {
+    Parameters<T> p;
+    p.temperature = temperature;
+    p.critical_temperature = critical_temperature;
+    p.lambda_0 = lambda_0;
+    p.exponent = exponent;
+    p.applied_field = applied_field;
+    p.dipole_field = dipole_field;
+    p.correlation_rate = correlation_rate;
+    p.slr_constant = slr_constant;
+    p.slr_exponent = slr_exponent;
+    p.surface_thickness = surface_thickness;
+    p.surface_rate = surface_rate;
+    p.film_thickness = film_thickness;
+    return p;
   };
 
   /// model parameters
@@ -731,22 +872,10 @@ public:
   T film_thickness;
 
 private:
-  /// vectors of data from csv file
-  std::vector<T> _energy;
-  std::vector<T> _alpha_1;
-  std::vector<T> _alpha_1_error;
-  std::vector<T> _beta_1;
-  std::vector<T> _beta_1_error;
-  std::vector<T> _z_max_1;
-  std::vector<T> _z_max_1_error;
-  std::vector<T> _fraction_1;
-  std::vector<T> _fraction_1_error;
-  std::vector<T> _alpha_2;
-  std::vector<T> _alpha_2_error;
-  std::vector<T> _beta_2;
-  std::vector<T> _beta_2_error;
-  std::vector<T> _z_max_2;
-  std::vector<T> _z_max_2_error;
+  /// interpolated stopping profile parameters
+  StoppingProfileInterpolator<T> _stopping_profile;
+  /// cached Gauss-Jacobi quadrature rules
+  StoppingProfileQuadratureCache<T> _quadrature;
 };
 
 /// Depth-resolved analyzer for thin films.
@@ -754,10 +883,8 @@ private:
 template <typename T = double> class DepthResolvedFilmAnalyzerNSS {
 public:
   /// constructor.
-  DepthResolvedFilmAnalyzerNSS(const std::string &csv_filename) {
-    // read in the data for the stopping profiles
-    read_csv_data(csv_filename);
-
+  DepthResolvedFilmAnalyzerNSS(const std::string &csv_filename)
+      : _stopping_profile(csv_filename) {
     // default initialized values
     temperature = 2.5;
     critical_temperature = 9.25;
@@ -773,125 +900,132 @@ public:
     film_thickness = 300.0;
   };
 
-  /// Read the CSV data
+  /// Read the CSV data (and build the interpolators).
   void read_csv_data(const std::string &csv_filename) {
-    // read the data into a ROOT DataFrame...
-    auto df = ROOT::RDF::MakeCsvDataFrame(csv_filename);
-    // ...and extract the values
-    _energy = df.Take<T>("Energy (keV)").GetValue();
-    _alpha_1 = df.Take<T>("alpha_1").GetValue();
-    _alpha_1_error = df.Take<T>("alpha_1_error").GetValue();
-    _beta_1 = df.Take<T>("beta_1").GetValue();
-    _beta_1_error = df.Take<T>("beta_1_error").GetValue();
-    _z_max_1 = df.Take<T>("z_max_1").GetValue();
-    _z_max_1_error = df.Take<T>("z_max_1_error").GetValue();
-    _fraction_1 = df.Take<T>("fraction_1").GetValue();
-    _fraction_1_error = df.Take<T>("fraction_1_error").GetValue();
-    _alpha_2 = df.Take<T>("alpha_2").GetValue();
-    _alpha_2_error = df.Take<T>("alpha_2_error").GetValue();
-    _beta_2 = df.Take<T>("beta_2").GetValue();
-    _beta_2_error = df.Take<T>("beta_2_error").GetValue();
-    _z_max_2 = df.Take<T>("z_max_2").GetValue();
-    _z_max_2_error = df.Take<T>("z_max_2_error").GetValue();
+    _stopping_profile.read_csv_data(csv_filename);
+    _quadrature.clear();
   };
 
   /// Return the the minium energy available for interpolation.
-  T energy_min() {
-    return *std::min_element(_energy.begin(), _energy.end()) +
-           std::sqrt(std::numeric_limits<T>::epsilon());
-  };
+  T energy_min() const { return _stopping_profile.energy_min(); };
 
   /// Return the the maximum energy available for interpolation.
-  T energy_max() {
-    return *std::max_element(_energy.begin(), _energy.end()) -
-           std::sqrt(std::numeric_limits<T>::epsilon());
-  };
+  T energy_max() const { return _stopping_profile.energy_max(); };
 
   /// Return an interpolated alpha_1 value.
-  T alpha_1(T energy_keV) {
-    static boost::math::interpolators::pchip<std::vector<T>>
-        alpha_interpolator_1(std::move(std::vector<T>(_energy)),
-                             std::move(std::vector<T>(_alpha_1)));
-    return alpha_interpolator_1(energy_keV);
+  T alpha_1(T energy_keV) const {
+    return _stopping_profile.alpha_1(energy_keV);
   };
 
   /// Return an interpolated alpha_2 value.
-  T alpha_2(T energy_keV) {
-    static boost::math::interpolators::pchip<std::vector<T>>
-        alpha_interpolator_2(std::move(std::vector<T>(_energy)),
-                             std::move(std::vector<T>(_alpha_2)));
-    return alpha_interpolator_2(energy_keV);
+  T alpha_2(T energy_keV) const {
+    return _stopping_profile.alpha_2(energy_keV);
   };
 
   /// Return an interpolated beta_1 value.
-  T beta_1(T energy_keV) {
-    static boost::math::interpolators::pchip<std::vector<T>>
-        beta_interpolator_1(std::move(std::vector<T>(_energy)),
-                            std::move(std::vector<T>(_beta_1)));
-    return beta_interpolator_1(energy_keV);
-  };
+  T beta_1(T energy_keV) const { return _stopping_profile.beta_1(energy_keV); };
 
   /// Return an interpolated beta_2 value.
-  T beta_2(T energy_keV) {
-    static boost::math::interpolators::pchip<std::vector<T>>
-        beta_interpolator_2(std::move(std::vector<T>(_energy)),
-                            std::move(std::vector<T>(_beta_2)));
-    return beta_interpolator_2(energy_keV);
-  };
+  T beta_2(T energy_keV) const { return _stopping_profile.beta_2(energy_keV); };
 
   /// Return an interpolated z_max_1 value.
-  T z_max_1(T energy_keV) {
-    static boost::math::interpolators::pchip<std::vector<T>>
-        z_max_interpolator_1(std::move(std::vector<T>(_energy)),
-                             std::move(std::vector<T>(_z_max_1)));
-    return z_max_interpolator_1(energy_keV);
+  T z_max_1(T energy_keV) const {
+    return _stopping_profile.z_max_1(energy_keV);
   };
 
   /// Return an interpolated z_max_2 value.
-  T z_max_2(T energy_keV) {
-    static boost::math::interpolators::pchip<std::vector<T>>
-        z_max_interpolator_2(std::move(std::vector<T>(_energy)),
-                             std::move(std::vector<T>(_z_max_2)));
-    return z_max_interpolator_2(energy_keV);
+  T z_max_2(T energy_keV) const {
+    return _stopping_profile.z_max_2(energy_keV);
   };
 
   /// Return an interpolated fraction_1 value.
-  T fraction_1(T energy_keV) {
-    static boost::math::interpolators::pchip<std::vector<T>>
-        fraction_interpolator_1(std::move(std::vector<T>(_energy)),
-                                std::move(std::vector<T>(_fraction_1)));
-    return fraction_interpolator_1(energy_keV);
+  T fraction_1(T energy_keV) const {
+    return _stopping_profile.fraction_1(energy_keV);
+  };
+
+  /// Return all of the stopping parameters at a given energy.
+  StoppingProfile<T> stopping_profile(T energy_keV) const {
+    return _stopping_profile(energy_keV);
   };
 
   /// Return the average implantation depth.
-  T z_average(T energy_keV) {
-    T a_1 = alpha_1(energy_keV);
-    T b_1 = beta_1(energy_keV);
-    T zm_1 = z_max_1(energy_keV);
-    T f_1 = fraction_1(energy_keV);
-    T a_2 = alpha_2(energy_keV);
-    T b_2 = beta_2(energy_keV);
-    T zm_2 = z_max_2(energy_keV);
-    return f_1 * zm_1 * a_1 / (a_1 + b_1) +
-           (1.0 - f_1) * zm_2 * a_2 / (a_2 + b_2);
-  };
-
-  /// depth-averaging using numeric integration
-  T operator()(T energy_keV) {
-    static boost::math::quadrature::tanh_sinh<T> integrator;
+  T z_average(T energy_keV) const {
+    return _stopping_profile(energy_keV).z_average();
+  };
+
+  /// depth-averaging using numeric integration (reentrant)
+  T operator()(T energy_keV, const Parameters<T> &parameters) const {
+    return average(_stopping_profile(energy_keV),
+                   SlrRateModel<T>(parameters));
+  };
+
+  /// depth-averaging over many (temperature, field, energy) points at once,
+  /// see triumf::bnmr::srf::depth_average.
+  void operator()(const std::vector<T> &temperatures,
+                  const std::vector<T> &applied_fields,
+                  const std::vector<T> &energies,
+                  const Parameters<T> &parameters,
+                  std::vector<T> &rates) const {
+    depth_average<T, SlrRateModel<T>>(*this, temperatures, applied_fields,
+                                      energies, parameters, rates);
+  };
+
+  /// depth-averaging for a given stopping profile and SLR rate model
+  T average(const StoppingProfile<T> &profile,
+            const SlrRateModel<T> &model) const {
+    // each thread gets its own quadrature workspace
+    static thread_local boost::math::quadrature::tanh_sinh<T> integrator;
     auto integrand = [&](T z) {
-      return slr_rate_film_nss_z<T>(
-                 z, temperature, critical_temperature, lambda_0, exponent,
-                 applied_field, dipole_field, correlation_rate, slr_constant,
-                 slr_exponent, surface_thickness, film_thickness) *
-             triumf::math::pdf::two_modified_beta<T>(
-                 z, alpha_1(energy_keV), beta_1(energy_keV),
-                 z_max_1(energy_keV), fraction_1(energy_keV),
-                 alpha_2(energy_keV), beta_2(energy_keV), z_max_2(energy_keV));
+      return model.slr_rate_film_nss_z(z) * profile(z);
     };
-    T z_max = std::max(z_max_1(energy_keV), z_max_2(energy_keV));
-    T Q = integrator.integrate(integrand, 0.0, z_max);
-    return Q;
+    triumf::instrumentation::Probe<T> probe(
+        "triumf::bnmr::srf::local::DepthResolvedFilmAnalyzerNSS::average");
+    return integrator.integrate(probe.counted(integrand), 0.0,
+                                profile.z_max(),
+                                boost::math::tools::root_epsilon<T>(),
+                                probe.error(), nullptr, probe.levels());
+  };
+
+  /// \brief Depth-averaging using fixed-node Gauss-Jacobi quadrature.
+  /// \details The quadrature rules are cached for each energy (see
+  /// StoppingProfileQuadrature). If error is not null, it is set to an
+  /// estimate of the absolute error.
+  T gauss_jacobi(T energy_keV, const Parameters<T> &parameters,
+                 T *error = nullptr) const {
+    const SlrRateModel<T> model(parameters);
+    return (*_quadrature(energy_keV, _stopping_profile))(
+        [&model](T z) { return model.slr_rate_film_nss_z(z); },
+        parameters.surface_thickness, error);
+  };
+
+  /// Return the number of Gauss-Jacobi nodes (per profile component).
+  std::size_t gauss_jacobi_nodes() const { return _quadrature.n_nodes(); };
+
+  /// Set the number of Gauss-Jacobi nodes (per profile component).
+  void set_gauss_jacobi_nodes(std::size_t n_nodes) {
+    _quadrature.set_n_nodes(n_nodes);
+  };
+
+  /// depth-averaging using numeric integration (public member parameters)
+  T operator()(T energy_keV) const {
+    return (*this)(energy_keV, parameters());
+  };
+
+  /// Return the public member model parameters as a Parameters struct.
+  Parameters<T> parameters() const {
+    Parameters<T> p;
+    p.temperature = temperature;
+    p.critical_temperature = critical_temperature;
+    p.lambda_0 = lambda_0;
+    p.exponent = exponent;
+    p.applied_field = applied_field;
+    p.dipole_field = dipole_field;
+    p.correlation_rate = correlation_rate;
+    p.slr_constant = slr_constant;
+    p.slr_exponent = slr_exponent;
+    p.surface_thickness = surface_thickness;
+    p.film_thickness = film_thickness;
+    return p;
   };
 
   /// model parameters
@@ -910,22 +1044,10 @@ public:
   T film_thickness;
 
 private:
-  /// vectors of data from csv file
-  std::vector<T> _energy;
-  std::vector<T> _alpha_1;
-  std::vector<T> _alpha_1_error;
-  std::vector<T> _beta_1;
-  std::vector<T> _beta_1_error;
-  std::vector<T> _z_max_1;
-  std::vector<T> _z_max_1_error;
-  std::vector<T> _fraction_1;
-  std::vector<T> _fraction_1_error;
-  std::vector<T> _alpha_2;
-  std::vector<T> _alpha_2_error;
-  std::vector<T> _beta_2;
-  std::vector<T> _beta_2_error;
-  std::vector<T> _z_max_2;
-  std::vector<T> _z_max_2_error;
+  /// interpolated stopping profile parameters
+  StoppingProfileInterpolator<T> _stopping_profile;
+  /// cached Gauss-Jacobi quadrature rules
+  StoppingProfileQuadratureCache<T> _quadrature;
 };
 
 } // namespace local
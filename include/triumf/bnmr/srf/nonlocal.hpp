@@ -5,20 +5,22 @@
 #include <algorithm>
 #include <cmath>
 #include <limits>
+#include <memory>
 #include <numeric>
 #include <vector>
 
 // Boost headers
-#include <boost/math/interpolators/pchip.hpp>
 #include <boost/math/quadrature/tanh_sinh.hpp>
 
 // triumf++ headers
 #include <triumf/bnmr/nuclei.hpp>
+#include <triumf/bnmr/srf/stopping_profile.hpp>
 #include <triumf/nmr/dipole_dipole.hpp>
 #include <triumf/nmr/nuclei.hpp>
 #include <triumf/numpy.hpp>
 #include <triumf/srim/pdf.hpp>
 #include <triumf/superconductivity/bcs.hpp>
+#include <triumf/superconductivity/field_profile_cache.hpp>
 #include <triumf/superconductivity/pippard.hpp>
 
 // ROOT headers
@@ -73,22 +75,119 @@ T slr_rate_z(T z, T temperature, T critical_temperature, T gap_meV, T xi_0,
   }
 }
 
+/// \brief Model parameters for the depth-resolved analyzer.
+/// \details Passed (by const reference) to the reentrant evaluation method,
+/// which makes it safe to call concurrently from several threads (e.g.,
+/// during a ROOT::Fit::ExecutionPolicy::kMultithread fit).
+template <typename T = double> struct Parameters {
+  T temperature = 2.5;
+  T critical_temperature = 9.25;
+  T gap_meV = triumf::superconductivity::bcs::gap_meV<T>(9.25);
+  T xi_0 = 39.0;
+  T mean_free_path = 1e4;
+  T lambda_0 = 40.0;
+  T exponent = 4.0;
+  T applied_field = 0.02;
+  T dipole_field = 1e-5;
+  T correlation_rate = 1.0 / 23.8e-6;
+  T slr_constant = 0.75;
+  T slr_exponent = 1.0;
+  T surface_thickness = 5.0;
+  T surface_rate = 10.0;
+  T electron_phonon_coupling = 1.0;
+};
+
+/// \brief SLR rate model at a fixed temperature and applied field.
+/// \details The depth-independent quantities are computed once upon
+/// construction. slr_rate_z(z) returns the same value as the free function
+/// slr_rate_z, but only evaluates the depth-dependent terms. If a field
+/// profile cache is given, the screening profile is taken from it (i.e.,
+/// computed at most once for each set of superconducting parameters) instead
+/// of evaluating a Fourier integral at each depth.
+template <typename T = double> class SlrRateModel {
+public:
+  using field_profile_cache = triumf::superconductivity::FieldProfileCache<T>;
+
+  /// constructor.
+  SlrRateModel(const Parameters<T> &parameters,
+               const field_profile_cache *field_profiles = nullptr)
+      : SlrRateModel(parameters.temperature, parameters.applied_field,
+                     parameters, field_profiles){};
+
+  /// constructor (temperature and field taken separately from the parameters).
+  SlrRateModel(T temperature, T applied_field, const Parameters<T> &parameters,
+               const field_profile_cache *field_profiles = nullptr)
+      : _parameters(parameters) {
+    _parameters.temperature = temperature;
+    _parameters.applied_field = applied_field;
+    // convert to values in the weak coupling limit
+    // see e.g., Eqs. (1) & (2) in:
+    // http://dx.doi.org/10.1103/PhysRevB.87.104508
+    _lambda_0_wc = _parameters.xi_0 * _parameters.electron_phonon_coupling;
+    _xi_0_wc =
+        _parameters.lambda_0 / std::sqrt(_parameters.electron_phonon_coupling);
+    // the SLR rate in the normal state
+    _ns_rate = _parameters.slr_constant *
+               std::pow(_parameters.temperature, _parameters.slr_exponent);
+    // the (shared) screening profile
+    if (field_profiles != nullptr and
+        not(_parameters.temperature > _parameters.critical_temperature)) {
+      _field_profile = (*field_profiles)(
+          _parameters.temperature, _parameters.critical_temperature,
+          _parameters.gap_meV, _xi_0_wc, _parameters.mean_free_path,
+          _lambda_0_wc, _parameters.exponent);
+    }
+  };
+
+  /// Model SLR rate (see slr_rate_z).
+  T slr_rate_z(T z) const {
+    T _z_ = z - _parameters.surface_thickness;
+    if (_z_ < 0.0) {
+      return _parameters.surface_rate;
+    } else {
+      return dd_rate(screened_field(_z_)) + _ns_rate;
+    }
+  };
+
+  /// The screened field (_z_ corrected for the surface layer).
+  T screened_field(T _z_) const {
+    if (_field_profile) {
+      return _parameters.applied_field * (*_field_profile)(_z_);
+    }
+    return _parameters.temperature > _parameters.critical_temperature
+               ? _parameters.applied_field
+               : triumf::superconductivity::pippard::field_penetration<T>(
+                     _z_, _parameters.temperature,
+                     _parameters.critical_temperature, _parameters.gap_meV,
+                     _xi_0_wc, _parameters.mean_free_path, _lambda_0_wc,
+                     _parameters.exponent, _parameters.applied_field);
+  };
+
+private:
+  /// dipole-dipole SLR rate for a given (local) field
+  T dd_rate(T field) const {
+    return triumf::nmr::dipole_dipole::slr_rate<T>(
+        field, _parameters.dipole_field, _parameters.correlation_rate,
+        triumf::bnmr::nuclei::lithium_8<T>::gyromagnetic_ratio(),
+        triumf::nmr::nuclei::niobium_93<T>::gyromagnetic_ratio());
+  };
+
+  /// model parameters
+  Parameters<T> _parameters;
+  /// precomputed (depth-independent) quantities
+  T _lambda_0_wc;
+  T _xi_0_wc;
+  T _ns_rate;
+  /// cached screening profile (if any)
+  std::shared_ptr<const typename field_profile_cache::Profile> _field_profile;
+};
+
 /// depth-resolved analyzer
 template <typename T = double> class DepthResolvedAnalyzer {
 public:
   /// constructor.
-  DepthResolvedAnalyzer(const std::string &csv_filename) {
-    // read the data into a ROOT DataFrame...
-    auto df = ROOT::RDF::MakeCsvDataFrame(csv_filename);
-    // ...and extract the values
-    _energy = df.Take<T>("Energy (keV)").GetValue();
-    _alpha = df.Take<T>("Alpha").GetValue();
-    _alpha_error = df.Take<T>("Alpha Error").GetValue();
-    _beta = df.Take<T>("Beta").GetValue();
-    _beta_error = df.Take<T>("Beta Error").GetValue();
-    _z_max = df.Take<T>("Max (nm)").GetValue();
-    _z_max_error = df.Take<T>("Max Error (nm)").GetValue();
-
+  DepthResolvedAnalyzer(const std::string &csv_filename)
+      : _stopping_profile(csv_filename) {
     // default initialized values
     temperature = 2.5;
     critical_temperature = 9.25;
@@ -111,68 +210,58 @@ public:
   };
 
   /// Return the the minium energy available for interpolation.
-  T energy_min() {
-    return *std::min_element(_energy.begin(), _energy.end()) +
-           std::sqrt(std::numeric_limits<T>::epsilon());
-  };
+  T energy_min() const { return _stopping_profile.energy_min(); };
 
   /// Return the the maximum energy availalbe for interpolation.
-  T energy_max() {
-    return *std::max_element(_energy.begin(), _energy.end()) -
-           std::sqrt(std::numeric_limits<T>::epsilon());
-  };
+  T energy_max() const { return _stopping_profile.energy_max(); };
 
   /// Return an interpolated alpha value.
-  T alpha(T energy_keV) {
-    static boost::math::interpolators::pchip<std::vector<T>> alpha_interpolator(
-        std::move(std::vector<T>(_energy)), std::move(std::vector<T>(_alpha)));
-    return alpha_interpolator(energy_keV);
-  };
+  T alpha(T energy_keV) const { return _stopping_profile.alpha_1(energy_keV); };
 
   /// Return an interpolated beta value.
-  T beta(T energy_keV) {
-    static boost::math::interpolators::pchip<std::vector<T>> beta_interpolator(
-        std::move(std::vector<T>(_energy)), std::move(std::vector<T>(_beta)));
-    return beta_interpolator(energy_keV);
-  };
+  T beta(T energy_keV) const { return _stopping_profile.beta_1(energy_keV); };
 
   /// Return an interpolated z_max value.
-  T z_max(T energy_keV) {
-    static boost::math::interpolators::pchip<std::vector<T>> z_max_interpolator(
-        std::move(std::vector<T>(_energy)), std::move(std::vector<T>(_z_max)));
-    return z_max_interpolator(energy_keV);
+  T z_max(T energy_keV) const { return _stopping_profile.z_max_1(energy_keV); };
+
+  /// Return all of the stopping parameters at a given energy.
+  StoppingProfile<T> stopping_profile(T energy_keV) const {
+    return _stopping_profile(energy_keV);
   };
 
   /// Return the average implantation depth.
-  T z_average(T energy_keV) {
+  T z_average(T energy_keV) const {
     T a = alpha(energy_keV);
     T b = beta(energy_keV);
     T zm = z_max(energy_keV);
     return zm * a / (a + b);
   };
 
-  /*
-  /// depth-averaging using numeric integration
-  T operator()(T energy_keV) {
-    // T a = alpha(energy_keV);
-    // T b = beta(energy_keV);
-    // T zm = z_max(energy_keV);
-    static boost::math::quadrature::tanh_sinh<T> integrator;
-    auto integrand = [&](T z) {
-      return slr_fcn(z, GLOBAL_R_0, GLOBAL_D_0) *
-             triumf::srim::pdf::modified_beta<T>(
-                 z, alpha(energy_keV), beta(energy_keV), z_max(energy_keV));
-    };
-    T Q = integrator.integrate(integrand, 0.0, z_max(energy_keV));
-    return Q;
-  };
-  */
-
-  // depth-averaging using "histogram" summation
-  T operator()(T energy_keV) {
+  // depth-averaging using "histogram" summation (reentrant)
+  T operator()(T energy_keV, const Parameters<T> &parameters) const {
+    return average(_stopping_profile(energy_keV),
+                   SlrRateModel<T>(parameters, field_profiles()));
+  };
+
+  /// depth-averaging over many (temperature, field, energy) points at once,
+  /// see triumf::bnmr::srf::depth_average.
+  void operator()(const std::vector<T> &temperatures,
+                  const std::vector<T> &applied_fields,
+                  const std::vector<T> &energies,
+                  const Parameters<T> &parameters,
+                  std::vector<T> &rates) const {
+    depth_average<T, SlrRateModel<T>>(*this, temperatures, applied_fields,
+                                      energies, parameters, rates,
+                                      field_profiles());
+  };
+
+  // depth-averaging using "histogram" summation for a given stopping profile
+  // and SLR rate model
+  T average(const StoppingProfile<T> &profile,
+            const SlrRateModel<T> &model) const {
     // bin edges
     std::vector<T> z_edge =
-        triumf::numpy::linspace<T>(0.0, z_max(energy_keV), n_bins);
+        triumf::numpy::linspace<T>(0.0, profile.z_max_1, n_bins);
     // bin widths - adjust ranges by one for "correct" size
     std::vector<T> dz(n_bins - 1);
     std::adjacent_difference(std::begin(z_edge) + 1, std::end(z_edge),
@@ -187,25 +276,79 @@ public:
     for (std::size_t i = 0; i < z.size(); ++i) {
       z.at(i) = z_edge.at(i) + 0.5 * dz.at(i);
       p_z.at(i) = triumf::srim::pdf::modified_beta<T>(
-          z.at(i), alpha(energy_keV), beta(energy_keV), z_max(energy_keV));
-      // std::cout << "p(" << z.at(i) << " nm ) = " << p_z.at(i) << " nm^-1\n";
+          z.at(i), profile.alpha_1, profile.beta_1, profile.z_max_1);
       weights.at(i) = dz.at(i) * p_z.at(i);
-      slr_rates.at(i) = slr_rate_z<T>(
-          z.at(i), temperature, critical_temperature, gap_meV, xi_0,
-          mean_free_path, lambda_0, exponent, applied_field, dipole_field,
-          correlation_rate, slr_constant, slr_exponent, surface_thickness,
-          surface_rate, electron_phonon_coupling);
+      slr_rates.at(i) = model.slr_rate_z(z.at(i));
     }
 
     T sum_weights = std::reduce(std::begin(weights), std::end(weights), 0.0);
-    // std::cout << "sum_weights = " << sum_weights << "\n";
     T sum_weights_slr = std::transform_reduce(
         std::begin(weights), std::end(weights), std::begin(slr_rates), 0.0);
-    // std::cout << "sum_weights_slr = " << sum_weights_slr << "\n";
     T weighted_average = sum_weights_slr / sum_weights;
     return weighted_average;
   };
 
+  /// \brief Depth-averaging using fixed-node Gauss-Jacobi quadrature.
+  /// \details The quadrature rules are cached for each energy (see
+  /// StoppingProfileQuadrature). If error is not null, it is set to an
+  /// estimate of the absolute error.
+  T gauss_jacobi(T energy_keV, const Parameters<T> &parameters,
+                 T *error = nullptr) const {
+    const SlrRateModel<T> model(parameters, field_profiles());
+    return (*_quadrature(energy_keV, _stopping_profile))(
+        [&model](T z) { return model.slr_rate_z(z); },
+        parameters.surface_thickness, error);
+  };
+
+  /// Return the number of Gauss-Jacobi nodes (per profile component).
+  std::size_t gauss_jacobi_nodes() const { return _quadrature.n_nodes(); };
+
+  /// Set the number of Gauss-Jacobi nodes (per profile component).
+  void set_gauss_jacobi_nodes(std::size_t n_nodes) {
+    _quadrature.set_n_nodes(n_nodes);
+  };
+
+  /// Return the cache of screening profiles shared by all energies.
+  const triumf::superconductivity::FieldProfileCache<T> &
+  field_profile_cache() const {
+    return _field_profiles;
+  };
+
+  /// \brief Set the number of cached screening profiles.
+  /// \details The cache is disabled (0) by default, such that the screening
+  /// profile is evaluated (by Fourier integration) at each depth. When
+  /// enabled, the profiles are instead interpolated (see FieldProfileCache),
+  /// which is much faster but only approximates the point-wise integrals.
+  void set_field_profile_cache_capacity(std::size_t capacity) {
+    _field_profiles.set_capacity(capacity);
+  };
+
+  // depth-averaging using "histogram" summation (public member parameters)
+  T operator()(T energy_keV) const {
+    return (*this)(energy_keV, parameters());
+  };
+
+  /// Return the public member model parameters as a Parameters struct.
+  Parameters<T> parameters() const {
+    Parameters<T> p;
+    p.temperature = temperature;
+    p.critical_temperature = critical_temperature;
+    p.gap_meV = gap_meV;
+    p.xi_0 = xi_0;
+    p.mean_free_path = mean_free_path;
+    p.lambda_0 = lambda_0;
+    p.exponent = exponent;
+    p.applied_field = applied_field;
+    p.dipole_field = dipole_field;
+    p.correlation_rate = correlation_rate;
+    p.slr_constant = slr_constant;
+    p.slr_exponent = slr_exponent;
+    p.surface_thickness = surface_thickness;
+    p.surface_rate = surface_rate;
+    p.electron_phonon_coupling = electron_phonon_coupling;
+    return p;
+  };
+
   /// model parameters
   T temperature;
   T critical_temperature;
@@ -224,16 +367,21 @@ public:
   T electron_phonon_coupling;
 
 private:
-  /// vectors of data from csv file
-  std::vector<T> _energy;
-  std::vector<T> _alpha;
-  std::vector<T> _alpha_error;
-  std::vector<T> _beta;
-  std::vector<T> _beta_error;
-  std::vector<T> _z_max;
-  std::vector<T> _z_max_error;
+  /// interpolated stopping profile parameters
+  StoppingProfileInterpolator<T> _stopping_profile;
+  /// cached Gauss-Jacobi quadrature rules
+  StoppingProfileQuadratureCache<T> _quadrature;
   /// number of bins + 1 used in the "histogram" summation
   std::size_t n_bins;
+  /// cached screening profiles (disabled by default)
+  triumf::superconductivity::FieldProfileCache<T> _field_profiles{
+      triumf::superconductivity::FieldProfileCache<T>::Theory::pippard, 0};
+
+  /// the field profile cache (or nullptr if disabled)
+  const triumf::superconductivity::FieldProfileCache<T> *
+  field_profiles() const {
+    return _field_profiles.capacity() > 0 ? &_field_profiles : nullptr;
+  };
 };
 
 } // namespace nonlocal
@@ -0,0 +1,533 @@
+#ifndef TRIUMF_BNMR_SRF_STOPPING_PROFILE_HPP
+#define TRIUMF_BNMR_SRF_STOPPING_PROFILE_HPP
+
+// C++ standard library headers
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Boost headers
+// n.b., fpclassify must precede pchip (for an unqualified isnan)
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/math/interpolators/pchip.hpp>
+#include <boost/math/special_functions/beta.hpp>
+
+// triumf++ headers
+#include <triumf/math/gauss_jacobi.hpp>
+#include <triumf/math/pdf.hpp>
+
+// ROOT headers
+#include <ROOT/RCsvDS.hxx>
+#include <ROOT/RDF/RInterface.hxx>
+#include <ROOT/RDataFrame.hxx>
+
+// TRIUMF: Canada's particle accelerator centre
+namespace triumf {
+
+// β-detected nuclear magnetic resonance (β-NMR)
+namespace bnmr {
+
+// superconducting radio-frequency (SRF) materials
+namespace srf {
+
+/// \brief Stopping profile parameters at a single implantation energy.
+/// \details A "snapshot" of the (interpolated) parameters describing the
+/// implantation profile as a weighted sum of two modified beta distributions.
+/// Evaluating it once per energy avoids repeated interpolation in the
+/// depth-averaging integrand.
+template <typename T = double> struct StoppingProfile {
+  T alpha_1;
+  T beta_1;
+  T z_max_1;
+  T fraction_1;
+  T alpha_2;
+  T beta_2;
+  T z_max_2;
+
+  /// Return the probability density at depth z.
+  T operator()(T z) const {
+    return triumf::math::pdf::two_modified_beta<T>(
+        z, alpha_1, beta_1, z_max_1, fraction_1, alpha_2, beta_2, z_max_2);
+  };
+
+  /// Return the maximum depth of the stopping profile.
+  T z_max() const { return std::max(z_max_1, z_max_2); };
+
+  /// Return the average implantation depth.
+  T z_average() const {
+    return fraction_1 * z_max_1 * alpha_1 / (alpha_1 + beta_1) +
+           (1.0 - fraction_1) * z_max_2 * alpha_2 / (alpha_2 + beta_2);
+  };
+};
+
+/// \brief Energy interpolation of tabulated stopping profile parameters.
+/// \details The parameters are read from a CSV file and each instance owns its
+/// own set of interpolators, so several profiles (e.g., for different
+/// materials) can be used at the same time.
+template <typename T = double> class StoppingProfileInterpolator {
+public:
+  using interpolator_type = boost::math::interpolators::pchip<std::vector<T>>;
+
+  /// constructor.
+  StoppingProfileInterpolator(const std::string &csv_filename) {
+    read_csv_data(csv_filename);
+  };
+
+  /// Read the CSV data and (re)build the interpolators.
+  /// Both the two-component (alpha_1, ..., z_max_2) and the single-component
+  /// (Alpha, Beta, Max) column layouts are understood.
+  void read_csv_data(const std::string &csv_filename) {
+    // read the data into a ROOT DataFrame...
+    auto df = ROOT::RDF::MakeCsvDataFrame(csv_filename);
+    // ...and extract the values
+    _energy = df.Take<T>("Energy (keV)").GetValue();
+    if (df.HasColumn("Alpha")) {
+      // a single beta distribution is the same as two identical ones
+      _alpha_1 = df.Take<T>("Alpha").GetValue();
+      _alpha_1_error = df.Take<T>("Alpha Error").GetValue();
+      _beta_1 = df.Take<T>("Beta").GetValue();
+      _beta_1_error = df.Take<T>("Beta Error").GetValue();
+      _z_max_1 = df.Take<T>("Max (nm)").GetValue();
+      _z_max_1_error = df.Take<T>("Max Error (nm)").GetValue();
+      _fraction_1 = std::vector<T>(_energy.size(), 1.0);
+      _fraction_1_error = std::vector<T>(_energy.size(), 0.0);
+      _alpha_2 = _alpha_1;
+      _alpha_2_error = _alpha_1_error;
+      _beta_2 = _beta_1;
+      _beta_2_error = _beta_1_error;
+      _z_max_2 = _z_max_1;
+      _z_max_2_error = _z_max_1_error;
+      build_interpolators();
+      return;
+    }
+    _alpha_1 = df.Take<T>("alpha_1").GetValue();
+    _alpha_1_error = df.Take<T>("alpha_1_error").GetValue();
+    _beta_1 = df.Take<T>("beta_1").GetValue();
+    _beta_1_error = df.Take<T>("beta_1_error").GetValue();
+    _z_max_1 = df.Take<T>("z_max_1").GetValue();
+    _z_max_1_error = df.Take<T>("z_max_1_error").GetValue();
+    _fraction_1 = df.Take<T>("fraction_1").GetValue();
+    _fraction_1_error = df.Take<T>("fraction_1_error").GetValue();
+    _alpha_2 = df.Take<T>("alpha_2").GetValue();
+    _alpha_2_error = df.Take<T>("alpha_2_error").GetValue();
+    _beta_2 = df.Take<T>("beta_2").GetValue();
+    _beta_2_error = df.Take<T>("beta_2_error").GetValue();
+    _z_max_2 = df.Take<T>("z_max_2").GetValue();
+    _z_max_2_error = df.Take<T>("z_max_2_error").GetValue();
+    build_interpolators();
+  };
+
+  /// Return the the minium energy available for interpolation.
+  T energy_min() const {
+    return *std::min_element(_energy.begin(), _energy.end()) +
+           std::sqrt(std::numeric_limits<T>::epsilon());
+  };
+
+  /// Return the the maximum energy available for interpolation.
+  T energy_max() const {
+    return *std::max_element(_energy.begin(), _energy.end()) -
+           std::sqrt(std::numeric_limits<T>::epsilon());
+  };
+
+  /// Return an interpolated alpha_1 value.
+  T alpha_1(T energy_keV) const {
+    return (*_alpha_interpolator_1)(energy_keV);
+  };
+
+  /// Return an interpolated alpha_2 value.
+  T alpha_2(T energy_keV) const {
+    return (*_alpha_interpolator_2)(energy_keV);
+  };
+
+  /// Return an interpolated beta_1 value.
+  T beta_1(T energy_keV) const {
+    return (*_beta_interpolator_1)(energy_keV);
+  };
+
+  /// Return an interpolated beta_2 value.
+  T beta_2(T energy_keV) const {
+    return (*_beta_interpolator_2)(energy_keV);
+  };
+
+  /// Return an interpolated z_max_1 value.
+  T z_max_1(T energy_keV) const {
+    return (*_z_max_interpolator_1)(energy_keV);
+  };
+
+  /// Return an interpolated z_max_2 value.
+  T z_max_2(T energy_keV) const {
+    return (*_z_max_interpolator_2)(energy_keV);
+  };
+
+  /// Return an interpolated fraction_1 value.
+  T fraction_1(T energy_keV) const {
+    return (*_fraction_interpolator_1)(energy_keV);
+  };
+
+  /// Return all of the (interpolated) stopping parameters at once.
+  StoppingProfile<T> operator()(T energy_keV) const {
+    return {alpha_1(energy_keV), beta_1(energy_keV), z_max_1(energy_keV),
+            fraction_1(energy_keV), alpha_2(energy_keV), beta_2(energy_keV),
+            z_max_2(energy_keV)};
+  };
+
+private:
+  /// build the interpolators (the pchip takes ownership of its inputs)
+  void build_interpolators() {
+    _alpha_interpolator_1 = make_interpolator(_alpha_1);
+    _beta_interpolator_1 = make_interpolator(_beta_1);
+    _z_max_interpolator_1 = make_interpolator(_z_max_1);
+    _fraction_interpolator_1 = make_interpolator(_fraction_1);
+    _alpha_interpolator_2 = make_interpolator(_alpha_2);
+    _beta_interpolator_2 = make_interpolator(_beta_2);
+    _z_max_interpolator_2 = make_interpolator(_z_max_2);
+  };
+
+  /// helper function for creating an interpolator over energy
+  std::shared_ptr<interpolator_type>
+  make_interpolator(const std::vector<T> &values) const {
+    return std::make_shared<interpolator_type>(std::vector<T>(_energy),
+                                               std::vector<T>(values));
+  };
+
+  /// vectors of data from csv file
+  std::vector<T> _energy;
+  std::vector<T> _alpha_1;
+  std::vector<T> _alpha_1_error;
+  std::vector<T> _beta_1;
+  std::vector<T> _beta_1_error;
+  std::vector<T> _z_max_1;
+  std::vector<T> _z_max_1_error;
+  std::vector<T> _fraction_1;
+  std::vector<T> _fraction_1_error;
+  std::vector<T> _alpha_2;
+  std::vector<T> _alpha_2_error;
+  std::vector<T> _beta_2;
+  std::vector<T> _beta_2_error;
+  std::vector<T> _z_max_2;
+  std::vector<T> _z_max_2_error;
+  /// interpolators for each of the stopping parameters
+  std::shared_ptr<interpolator_type> _alpha_interpolator_1;
+  std::shared_ptr<interpolator_type> _beta_interpolator_1;
+  std::shared_ptr<interpolator_type> _z_max_interpolator_1;
+  std::shared_ptr<interpolator_type> _fraction_interpolator_1;
+  std::shared_ptr<interpolator_type> _alpha_interpolator_2;
+  std::shared_ptr<interpolator_type> _beta_interpolator_2;
+  std::shared_ptr<interpolator_type> _z_max_interpolator_2;
+};
+
+/// \brief Gauss-Jacobi quadrature over a stopping profile.
+/// \details Each modified beta distribution component of the profile is
+/// integrated with its own n-point Gauss-Jacobi rule, whose weight function
+/// absorbs the (possibly singular) endpoint behaviour of the distribution.
+/// This gives (near) exponential convergence for smooth integrands, using far
+/// fewer evaluations than adaptive or "histogram" quadrature. The rules are
+/// computed once upon construction (i.e., once per implantation energy). A
+/// depth z_split below which the integrand is constant (e.g., the surface
+/// "dead layer") can be specified, in which case the shallow part is
+/// integrated exactly (using the incomplete beta function) and the Gauss-Jacobi
+/// rule is applied to the deeper part only. An error estimate is obtained by
+/// comparison with a rule of half the order.
+template <typename T = double> class StoppingProfileQuadrature {
+public:
+  /// constructor.
+  StoppingProfileQuadrature(const StoppingProfile<T> &profile,
+                            std::size_t n_nodes)
+      : _n_nodes(n_nodes) {
+    const std::size_t n_low = std::max<std::size_t>(1, n_nodes / 2);
+    const bool same_components = profile.alpha_1 == profile.alpha_2 and
+                                 profile.beta_1 == profile.beta_2 and
+                                 profile.z_max_1 == profile.z_max_2;
+    if (same_components or profile.fraction_1 == 1.0) {
+      _components.emplace_back(profile.alpha_1, profile.beta_1,
+                               profile.z_max_1, 1.0, n_nodes, n_low);
+    } else {
+      _components.emplace_back(profile.alpha_1, profile.beta_1,
+                               profile.z_max_1, profile.fraction_1, n_nodes,
+                               n_low);
+      _components.emplace_back(profile.alpha_2, profile.beta_2,
+                               profile.z_max_2, 1.0 - profile.fraction_1,
+                               n_nodes, n_low);
+    }
+  };
+
+  /// Return the number of nodes (per profile component).
+  std::size_t n_nodes() const { return _n_nodes; };
+
+  /// \brief Average f(z) over the stopping profile.
+  /// \details f must be constant for z < z_split. If error is not null, it is
+  /// set to an estimate of the absolute error.
+  template <typename F>
+  T operator()(F f, T z_split = 0.0, T *error = nullptr) const {
+    T average = integrate(f, z_split, false);
+    if (error != nullptr) {
+      *error = std::abs(average - integrate(f, z_split, true));
+    }
+    return average;
+  };
+
+private:
+  /// Gauss-Jacobi rules for a single modified beta distribution component
+  struct Component {
+    Component(T alpha_, T beta_, T z_max_, T fraction_, std::size_t n,
+              std::size_t n_low)
+        : alpha(alpha_), beta(beta_), z_max(z_max_), fraction(fraction_),
+          full(n, beta_ - 1.0, alpha_ - 1.0),
+          full_low(n_low, beta_ - 1.0, alpha_ - 1.0),
+          upper(n, beta_ - 1.0, 0.0), upper_low(n_low, beta_ - 1.0, 0.0),
+          norm(1.0 / boost::math::beta<T>(alpha_, beta_)) {}
+    T alpha;
+    T beta;
+    T z_max;
+    T fraction;
+    /// rules for the whole of [0, z_max] (weight (1 - y)^(β-1) y^(α-1))
+    triumf::math::quadrature::gauss_jacobi<T> full;
+    triumf::math::quadrature::gauss_jacobi<T> full_low;
+    /// rules for [z_split, z_max] (weight (1 - y)^(β-1))
+    triumf::math::quadrature::gauss_jacobi<T> upper;
+    triumf::math::quadrature::gauss_jacobi<T> upper_low;
+    /// normalization of the upper rules
+    T norm;
+  };
+
+  /// the (normalized) integral of f over the stopping profile
+  template <typename F> T integrate(F f, T z_split, bool low_order) const {
+    T sum = 0.0;
+    // probability of stopping in the region where f is constant
+    T p_below = 0.0;
+    for (const auto &c : _components) {
+      const T y_split = z_split / c.z_max;
+      if (y_split <= 0.0) {
+        const auto &rule = low_order ? c.full_low : c.full;
+        // n.b., the weights sum to 2^(α+β-1) B(α, β)
+        T sum_c = 0.0;
+        T sum_w = 0.0;
+        for (std::size_t i = 0; i < rule.size(); ++i) {
+          sum_c += rule.weights()[i] *
+                   f(0.5 * c.z_max * (1.0 + rule.abscissa()[i]));
+          sum_w += rule.weights()[i];
+        }
+        sum += c.fraction * sum_c / sum_w;
+      } else if (y_split >= 1.0) {
+        p_below += c.fraction;
+      } else {
+        const auto &rule = low_order ? c.upper_low : c.upper;
+        // n.b., the weights sum to 2^β / β
+        const T h = 0.5 * (1.0 - y_split);
+        T sum_c = 0.0;
+        for (std::size_t i = 0; i < rule.size(); ++i) {
+          const T y = y_split + h * (1.0 + rule.abscissa()[i]);
+          sum_c += rule.weights()[i] * std::pow(y, c.alpha - 1.0) *
+                   f(c.z_max * y);
+        }
+        sum += c.fraction * c.norm * std::pow(h, c.beta) * sum_c;
+        p_below += c.fraction * boost::math::ibeta(c.alpha, c.beta, y_split);
+      }
+    }
+    if (p_below > 0.0) {
+      sum += p_below * f(0.5 * z_split);
+    }
+    return sum;
+  };
+
+  /// number of nodes (per component)
+  std::size_t _n_nodes;
+  /// the profile components
+  std::vector<Component> _components;
+};
+
+/// \brief Bounded (least recently used) per-energy cache of stopping profile
+/// quadrature rules.
+/// \details Energies that agree to within a relative tolerance share the same
+/// rules. The rules are computed without holding the lock, such that threads
+/// needing different energies don't wait for each other. When full, the least
+/// recently used rules are discarded. Safe to use concurrently from several
+/// threads.
+template <typename T = double> class StoppingProfileQuadratureCache {
+public:
+  using quadrature_type = StoppingProfileQuadrature<T>;
+
+  /// constructor.
+  StoppingProfileQuadratureCache(std::size_t n_nodes = 32,
+                                 std::size_t capacity = 64,
+                                 T tolerance = 1e-12)
+      : _n_nodes(n_nodes), _capacity(capacity), _tolerance(tolerance){};
+
+  /// copy constructor (the cached rules are not copied).
+  StoppingProfileQuadratureCache(const StoppingProfileQuadratureCache &other)
+      : _n_nodes(other.n_nodes()), _capacity(other.capacity()),
+        _tolerance(other._tolerance){};
+
+  /// copy assignment (the cached rules are not copied).
+  StoppingProfileQuadratureCache &
+  operator=(const StoppingProfileQuadratureCache &other) {
+    if (this != &other) {
+      const std::size_t n_nodes = other.n_nodes();
+      const std::size_t capacity = other.capacity();
+      std::lock_guard<std::mutex> lock(_mutex);
+      _n_nodes = n_nodes;
+      _capacity = capacity;
+      _tolerance = other._tolerance;
+      _cache.clear();
+    }
+    return *this;
+  };
+
+  /// Return the number of nodes (per profile component).
+  std::size_t n_nodes() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _n_nodes;
+  };
+
+  /// Set the number of nodes (per profile component), clearing the cache.
+  void set_n_nodes(std::size_t n_nodes) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _n_nodes = n_nodes;
+    _cache.clear();
+  };
+
+  /// Return the maximum number of cached energies.
+  std::size_t capacity() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _capacity;
+  };
+
+  /// Set the maximum number of cached energies (0 disables storing them).
+  void set_capacity(std::size_t capacity) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _capacity = capacity;
+    while (_cache.size() > _capacity) {
+      _cache.pop_back();
+    }
+  };
+
+  /// Return the number of cached energies.
+  std::size_t size() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _cache.size();
+  };
+
+  /// Clear the cache (e.g., after reading new stopping profile data).
+  void clear() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _cache.clear();
+  };
+
+  /// Return the (cached) quadrature rules at a given energy.
+  std::shared_ptr<const quadrature_type>
+  operator()(T energy_keV,
+             const StoppingProfileInterpolator<T> &interpolator) const {
+    std::size_t n_nodes;
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      if (auto rules = find(energy_keV)) {
+        return rules;
+      }
+      n_nodes = _n_nodes;
+    }
+    // compute the rules without holding the lock
+    auto rules = std::make_shared<const quadrature_type>(
+        interpolator(energy_keV), n_nodes);
+    std::lock_guard<std::mutex> lock(_mutex);
+    // (unless the number of nodes has changed in the meantime)
+    if (_capacity > 0 and n_nodes == _n_nodes) {
+      // another thread may have computed the same rules in the meantime
+      if (auto existing = find(energy_keV)) {
+        return existing;
+      }
+      _cache.emplace_front(energy_keV, rules);
+      while (_cache.size() > _capacity) {
+        _cache.pop_back();
+      }
+    }
+    return rules;
+  };
+
+private:
+  /// Return the cached rules for a given energy (moving them to the front),
+  /// if any (n.b., the caller holds the lock).
+  std::shared_ptr<const quadrature_type> find(T energy_keV) const {
+    for (auto it = _cache.begin(); it != _cache.end(); ++it) {
+      if (it->first == energy_keV or
+          std::abs(it->first - energy_keV) <=
+              _tolerance *
+                  std::max(std::abs(it->first), std::abs(energy_keV))) {
+        // move to the front (most recently used)
+        _cache.splice(_cache.begin(), _cache, it);
+        return _cache.front().second;
+      }
+    }
+    return nullptr;
+  };
+
+  /// number of nodes (per component)
+  std::size_t _n_nodes;
+  /// maximum number of energies
+  std::size_t _capacity;
+  /// relative tolerance for matching energies
+  T _tolerance;
+  /// cached rules for each energy (most recently used first)
+  mutable std::list<std::pair<T, std::shared_ptr<const quadrature_type>>>
+      _cache;
+  /// guard for the above
+  mutable std::mutex _mutex;
+};
+
+/// \brief Depth-average a model over many (temperature, field, energy) points.
+/// \details Points are grouped such that the stopping profile is evaluated
+/// only once per unique implantation energy and the (depth-independent parts
+/// of the) SLR rate model only once per unique (temperature, applied field)
+/// pair. The analyzer must provide stopping_profile(energy) and
+/// average(profile, model) member functions, and the Model must be
+/// constructible from (temperature, applied_field, parameters, model_args...).
+template <typename T, typename Model, typename Analyzer, typename Parameters,
+          typename... ModelArgs>
+void depth_average(const Analyzer &analyzer, const std::vector<T> &temperatures,
+                   const std::vector<T> &applied_fields,
+                   const std::vector<T> &energies, const Parameters &parameters,
+                   std::vector<T> &rates, const ModelArgs &... model_args) {
+  if (temperatures.size() != energies.size() or
+      applied_fields.size() != energies.size()) {
+    throw std::invalid_argument(
+        "triumf::bnmr::srf::depth_average: input sizes differ");
+  }
+  rates.resize(energies.size());
+  // stopping profiles for each unique energy
+  std::map<T, StoppingProfile<T>> profiles;
+  // SLR rate models for each unique (temperature, field) pair
+  std::map<std::pair<T, T>, Model> models;
+  for (std::size_t i = 0; i < energies.size(); ++i) {
+    auto profile = profiles.find(energies[i]);
+    if (profile == profiles.end()) {
+      profile = profiles
+                    .emplace(energies[i],
+                             analyzer.stopping_profile(energies[i]))
+                    .first;
+    }
+    const std::pair<T, T> key(temperatures[i], applied_fields[i]);
+    auto model = models.find(key);
+    if (model == models.end()) {
+      model = models
+                  .emplace(key, Model(temperatures[i], applied_fields[i],
+                                      parameters, model_args...))
+                  .first;
+    }
+    rates[i] = analyzer.average(profile->second, model->second);
+  }
+}
+
+} // namespace srf
+
+} // namespace bnmr
+
+} // namespace triumf
+
+#endif // TRIUMF_BNMR_SRF_STOPPING_PROFILE_HPP
@@ -0,0 +1,108 @@
+#ifndef TRIUMF_EXTERN_TEMPLATES_HPP
+#define TRIUMF_EXTERN_TEMPLATES_HPP
+
+// triumf++ headers
+#include <triumf/bnmr/decay_chain.hpp>
+#include <triumf/bnmr/slr/bi_exp.hpp>
+#include <triumf/bnmr/slr/cbrt_exp.hpp>
+#include <triumf/bnmr/slr/exp.hpp>
+#include <triumf/bnmr/slr/gauss_dist_exp.hpp>
+#include <triumf/bnmr/slr/mod_str_exp.hpp>
+#include <triumf/bnmr/slr/sq_exp.hpp>
+#include <triumf/bnmr/slr/sqrt_exp.hpp>
+#include <triumf/bnmr/slr/str_exp.hpp>
+#include <triumf/nmr/hebel_slichter.hpp>
+#include <triumf/nmr/spectral_density.hpp>
+#include <triumf/superconductivity/bcs.hpp>
+#include <triumf/superconductivity/field_profile.hpp>
+#include <triumf/superconductivity/field_profile_cache.hpp>
+#include <triumf/superconductivity/pippard.hpp>
+
+// Explicit instantiations of the library's most expensive templates for
+// float, double, and long double, which are compiled once into libtriumfpp
+// (see `make lib` and src/triumfpp.cpp). Including this header (e.g., via
+// triumf/pch.hpp, or with -include triumf/extern_templates.hpp) declares
+// them extern, such that they are no longer instantiated (i.e., compiled) in
+// every translation unit using them. The program must then be linked with
+// libtriumfpp (e.g., -L lib -ltriumfpp). Note: functions defined inline
+// (e.g., within a class) may still be instantiated where the optimizer
+// inlines them. The library and the program must also agree on
+// TRIUMF_INSTRUMENTATION (see triumf/instrumentation.hpp).
+//
+// Only the headers that depend on neither ROOT nor a non-template (i.e.,
+// non-inline) function are included.
+
+#ifndef TRIUMF_EXTERN_TEMPLATE
+#define TRIUMF_EXTERN_TEMPLATE extern template
+#endif
+
+#define TRIUMF_INSTANTIATE_TEMPLATES(T)                                        \
+  /* triumf::superconductivity::bcs */                                         \
+  TRIUMF_EXTERN_TEMPLATE T triumf::superconductivity::bcs::reduced_gap_solver< \
+      T>(T);                                                                   \
+  TRIUMF_EXTERN_TEMPLATE T triumf::superconductivity::bcs::reduced_gap<T>(T);  \
+  TRIUMF_EXTERN_TEMPLATE T triumf::superconductivity::bcs::reduced_gap<T>(T,   \
+                                                                          T);  \
+  TRIUMF_EXTERN_TEMPLATE T triumf::superconductivity::bcs::gap<T>(T, T, T);    \
+  TRIUMF_EXTERN_TEMPLATE T triumf::superconductivity::bcs::gap_meV<T>(T);      \
+  TRIUMF_EXTERN_TEMPLATE T triumf::superconductivity::bcs::kernel<T>(          \
+      T, T, T, T, T, T, T, T);                                                 \
+  TRIUMF_EXTERN_TEMPLATE T triumf::superconductivity::bcs::reduced_kernel<T>(  \
+      T, T, T, T, T, T, T, T);                                                 \
+  TRIUMF_EXTERN_TEMPLATE T                                                     \
+  triumf::superconductivity::bcs::penetration_depth<T>(T, T, T, T, T, T, T);   \
+  TRIUMF_EXTERN_TEMPLATE T                                                     \
+  triumf::superconductivity::bcs::reduced_field_penetration<T>(                \
+      T, T, T, T, T, T, T, T);                                                 \
+  TRIUMF_EXTERN_TEMPLATE std::vector<T>                                        \
+  triumf::superconductivity::bcs::reduced_field_penetration<T>(                \
+      const std::vector<T> &, T, T, T, T, T, T, T);                            \
+  TRIUMF_EXTERN_TEMPLATE T                                                     \
+  triumf::superconductivity::bcs::field_penetration<T>(T, T, T, T, T, T, T, T, \
+                                                       T);                     \
+  TRIUMF_EXTERN_TEMPLATE class triumf::superconductivity::bcs::KernelContext<  \
+      T>;                                                                      \
+  /* triumf::superconductivity::pippard */                                     \
+  TRIUMF_EXTERN_TEMPLATE T triumf::superconductivity::pippard::kernel<T>(      \
+      T, T, T, T, T, T, T, T);                                                 \
+  TRIUMF_EXTERN_TEMPLATE T                                                     \
+  triumf::superconductivity::pippard::reduced_kernel<T>(T, T, T, T, T, T, T,   \
+                                                        T);                    \
+  TRIUMF_EXTERN_TEMPLATE T                                                     \
+  triumf::superconductivity::pippard::reduced_field_penetration<T>(            \
+      T, T, T, T, T, T, T, T);                                                 \
+  TRIUMF_EXTERN_TEMPLATE std::vector<T>                                        \
+  triumf::superconductivity::pippard::reduced_field_penetration<T>(            \
+      const std::vector<T> &, T, T, T, T, T, T, T);                            \
+  TRIUMF_EXTERN_TEMPLATE T                                                     \
+  triumf::superconductivity::pippard::field_penetration<T>(                    \
+      T, T, T, T, T, T, T, T, T);                                              \
+  /* triumf::superconductivity */                                              \
+  TRIUMF_EXTERN_TEMPLATE class triumf::superconductivity::FieldProfile<T>;     \
+  TRIUMF_EXTERN_TEMPLATE class triumf::superconductivity::FieldProfileCache<  \
+      T>;                                                                      \
+  /* triumf::nmr */                                                            \
+  TRIUMF_EXTERN_TEMPLATE T triumf::nmr::hebel_slichter::slr_ratio<T>(T, T, T,  \
+                                                                     T, T);    \
+  TRIUMF_EXTERN_TEMPLATE class triumf::nmr::hebel_slichter::SlrRatio<T>;       \
+  TRIUMF_EXTERN_TEMPLATE class triumf::nmr::DistributedSpectralDensity<T>;     \
+  TRIUMF_EXTERN_TEMPLATE class triumf::nmr::SpectralDensity<T>;                \
+  /* triumf::bnmr */                                                           \
+  TRIUMF_EXTERN_TEMPLATE class triumf::bnmr::DecayChain<T>;                    \
+  TRIUMF_EXTERN_TEMPLATE class triumf::bnmr::slr::PulsedExp<T>;                \
+  TRIUMF_EXTERN_TEMPLATE class triumf::bnmr::slr::PulsedSqExp<T>;              \
+  TRIUMF_EXTERN_TEMPLATE class triumf::bnmr::slr::PulsedSqrtExp<T>;            \
+  TRIUMF_EXTERN_TEMPLATE class triumf::bnmr::slr::PulsedCbrtExp<T>;            \
+  TRIUMF_EXTERN_TEMPLATE class triumf::bnmr::slr::StrExpIntegral<T>;           \
+  TRIUMF_EXTERN_TEMPLATE class triumf::bnmr::slr::PulsedStrExp<T>;             \
+  TRIUMF_EXTERN_TEMPLATE class triumf::bnmr::slr::PulsedModStrExp<T>;          \
+  TRIUMF_EXTERN_TEMPLATE class triumf::bnmr::slr::PulsedBiExp<T>;              \
+  TRIUMF_EXTERN_TEMPLATE class triumf::bnmr::slr::PulsedGaussDistExp<T>;
+
+TRIUMF_INSTANTIATE_TEMPLATES(float)
+TRIUMF_INSTANTIATE_TEMPLATES(double)
+TRIUMF_INSTANTIATE_TEMPLATES(long double)
+
+#undef TRIUMF_INSTANTIATE_TEMPLATES
+
+#endif // TRIUMF_EXTERN_TEMPLATES_HPP
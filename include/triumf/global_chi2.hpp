@@ -1,15 +1,34 @@
 #ifndef TRIUMF_GLOBAL_CHI2_HPP
 #define TRIUMF_GLOBAL_CHI2_HPP
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
 #include <vector>
 
 #include <Fit/BinData.h>
 #include <Fit/Chi2FCN.h>
+#include <Math/IFunction.h>
 
 // TRIUMF: Canada's particle accelerator centre
 namespace triumf {
 
-/// class for calculating the "global" chi2 using ROOT's fitting utilities
+/// \brief class for calculating the "global" chi2 using ROOT's fitting
+/// utilities
+/// \details The parameters passed to each dataset's chi2 function, along with
+/// the resulting chi2, are kept from one call to the next. A dataset is only
+/// re-evaluated if (at least) one of its parameters has changed, such that,
+/// e.g., varying a parameter that is local to one dataset costs a single
+/// dataset evaluation. The number of evaluated and skipped datasets is
+/// counted.
 class global_chi2 {
 public:
   /// constructor
@@ -19,32 +38,95 @@ public:
       chi2.push_back(c2v);
     }
     parameter_index = parameter_index_matrix;
+    // storage for each dataset's (last) parameters & chi2
+    offset.push_back(0);
+    for (auto &i : parameter_index) {
+      offset.push_back(offset.back() + i.size());
+    }
+    last_parameters.resize(offset.back());
+    last_chi2.resize(chi2.size());
+    evaluated.assign(chi2.size(), false);
   };
 
-  /// necessary for integration w/ ROOT's fitting objects
-  double operator()(const double *par) const {
-    // Function parameters for chi2 calculation
-    std::vector<std::vector<double>> parameters;
-    parameters.reserve(chi2.size());
+  /// copy constructor (the cached chi2s and counters are not copied)
+  global_chi2(const global_chi2 &other)
+      : parameter_index(other.parameter_index), chi2(other.chi2),
+        offset(other.offset), last_parameters(other.last_parameters.size()),
+        last_chi2(other.last_chi2.size()), evaluated(other.chi2.size(), false),
+        n_evaluated(0), n_skipped(0){};
 
-    // Map the array of shared/free parameters to a matrix using the parameter
-    // index matrix
-    for (auto &i : parameter_index) {
-      std::vector<double> tmp_parameters;
-      for (auto &j : i) {
-        tmp_parameters.push_back(par[j]);
-      }
-      parameters.push_back(tmp_parameters);
+  /// copy assignment (the cached chi2s and counters are not copied)
+  global_chi2 &operator=(const global_chi2 &other) {
+    if (this != &other) {
+      std::lock_guard<std::mutex> lock(mutex);
+      parameter_index = other.parameter_index;
+      chi2 = other.chi2;
+      offset = other.offset;
+      last_parameters.assign(other.last_parameters.size(), 0.0);
+      last_chi2.assign(other.last_chi2.size(), 0.0);
+      evaluated.assign(other.chi2.size(), false);
+      n_evaluated = 0;
+      n_skipped = 0;
     }
+    return *this;
+  };
 
+  /// necessary for integration w/ ROOT's fitting objects
+  double operator()(const double *par) const {
+    std::lock_guard<std::mutex> lock(mutex);
     // sum up the chi2s from each dataset
     double global_chi2 = 0.0;
     for (std::size_t i = 0; i < chi2.size(); ++i) {
-      global_chi2 += (*chi2.at(i))(parameters.at(i).data());
+      // Map the array of shared/free parameters onto the dataset's parameters
+      // using the parameter index matrix, noting any changes
+      double *parameters = last_parameters.data() + offset[i];
+      bool changed = not evaluated[i];
+      for (std::size_t j = 0; j < parameter_index[i].size(); ++j) {
+        const double value = par[parameter_index[i][j]];
+        if (not(parameters[j] == value)) {
+          changed = true;
+          parameters[j] = value;
+        }
+      }
+      if (changed) {
+        evaluated[i] = false;
+        last_chi2[i] = get_chi2(chi2[i], parameters);
+        evaluated[i] = true;
+        ++n_evaluated;
+      } else {
+        ++n_skipped;
+      }
+      global_chi2 += last_chi2[i];
     }
     return global_chi2;
   };
 
+  /// return the number of dataset evaluations
+  std::size_t evaluations() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return n_evaluated;
+  };
+
+  /// return the number of dataset evaluations skipped (i.e., because none of
+  /// the dataset's parameters changed)
+  std::size_t skipped() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return n_skipped;
+  };
+
+  /// reset the evaluation counters
+  void reset_counters() {
+    std::lock_guard<std::mutex> lock(mutex);
+    n_evaluated = 0;
+    n_skipped = 0;
+  };
+
+  /// forget the cached chi2s (e.g., if the datasets have changed)
+  void clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::fill(evaluated.begin(), evaluated.end(), false);
+  };
+
   /// return the number of data points used during fitting for calculating the
   /// reduced chi^2
   static unsigned int ndp(const std::vector<ROOT::Fit::BinData> &data_vector) {
@@ -60,6 +142,17 @@ private:
   std::vector<std::vector<int>> parameter_index;
   /// holder of the individual chi2 functions
   std::vector<const ROOT::Math::IMultiGenFunction *> chi2;
+  /// each dataset's parameters are last_parameters[offset[i]:offset[i + 1]]
+  std::vector<std::size_t> offset;
+  /// parameters & chi2 from each dataset's last evaluation
+  mutable std::vector<double> last_parameters;
+  mutable std::vector<double> last_chi2;
+  mutable std::vector<bool> evaluated;
+  /// evaluation counters
+  mutable std::size_t n_evaluated = 0;
+  mutable std::size_t n_skipped = 0;
+  /// guard for the above
+  mutable std::mutex mutex;
   /// helper function for calculating individual chi2
   static double get_chi2(const ROOT::Math::IMultiGenFunction *function,
                          const double *parameters) {
@@ -67,6 +160,353 @@ private:
   };
 }; //  class global_chi2
 
+/// \brief "Global" chi2, with the individual datasets evaluated concurrently.
+/// \details Equivalent to global_chi2, but the mapping of the global
+/// (shared/free) parameters onto those of each dataset is precomputed as a
+/// flat gather index, such that nothing is allocated per call. The datasets
+/// are distributed over a pool of worker threads (created once, upon
+/// construction), each dataset's chi2 is stored separately, and these are
+/// summed in dataset order. The result is therefore identical (bit for bit)
+/// for any number of threads. The gradient is the sum of the datasets'
+/// gradients: those of datasets that are ROOT::Math::IMultiGradFunctions
+/// (e.g., ROOT::Fit::Chi2GradFunction) are used directly, otherwise each
+/// dataset's own parameters are varied by central differences. As in
+/// global_chi2, only the datasets whose parameters have changed since their
+/// last evaluation are re-evaluated.
+class parallel_global_chi2 : public ROOT::Math::IMultiGradFunction {
+public:
+  /// constructor.
+  template <typename Chi2>
+  parallel_global_chi2(
+      const std::vector<Chi2 *> &chi2_vector,
+      const std::vector<std::vector<int>> &parameter_index_matrix,
+      unsigned int n_threads = std::thread::hardware_concurrency())
+      : _n_dim(0), _n_threads(std::max(1u, n_threads)) {
+    static_assert(std::is_base_of<ROOT::Math::IMultiGenFunction, Chi2>::value,
+                  "triumf::parallel_global_chi2: the chi2 functions must be "
+                  "ROOT::Math::IMultiGenFunctions");
+    if (chi2_vector.size() != parameter_index_matrix.size()) {
+      throw std::invalid_argument(
+          "triumf::parallel_global_chi2: one set of parameter indices is "
+          "needed for each chi2 function");
+    }
+    _offset.push_back(0);
+    for (std::size_t i = 0; i < chi2_vector.size(); ++i) {
+      if (chi2_vector[i]->NDim() != parameter_index_matrix[i].size()) {
+        throw std::invalid_argument(
+            "triumf::parallel_global_chi2: the number of parameter indices "
+            "doesn't match the chi2 function's dimension");
+      }
+      _chi2.push_back(chi2_vector[i]);
+      _chi2_gradient.push_back(
+          dynamic_cast<const ROOT::Math::IMultiGradFunction *>(
+              _chi2.back()));
+      for (int j : parameter_index_matrix[i]) {
+        if (j < 0) {
+          throw std::invalid_argument(
+              "triumf::parallel_global_chi2: negative parameter index");
+        }
+        _index.push_back(j);
+        _n_dim = std::max(_n_dim, static_cast<unsigned int>(j) + 1);
+      }
+      _offset.push_back(_index.size());
+    }
+    allocate();
+  };
+
+  /// copy constructor (the copy has its own worker threads).
+  parallel_global_chi2(const parallel_global_chi2 &other)
+      : ROOT::Math::IMultiGradFunction(), _chi2(other._chi2),
+        _chi2_gradient(other._chi2_gradient), _offset(other._offset),
+        _index(other._index), _n_dim(other._n_dim),
+        _n_threads(other._n_threads) {
+    allocate();
+  };
+
+  /// no copy assignment.
+  parallel_global_chi2 &operator=(const parallel_global_chi2 &) = delete;
+
+  /// destructor (stops the worker threads).
+  ~parallel_global_chi2() override {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _stop = true;
+    }
+    _start.notify_all();
+    for (auto &worker : _workers) {
+      worker.join();
+    }
+  };
+
+  /// Return a copy (required by ROOT).
+  parallel_global_chi2 *Clone() const override {
+    return new parallel_global_chi2(*this);
+  };
+
+  /// Return the number of (global) fit parameters.
+  unsigned int NDim() const override { return _n_dim; };
+
+  /// Return the number of datasets.
+  std::size_t size() const { return _chi2.size(); };
+
+  /// Return the number of threads used for the evaluation.
+  unsigned int n_threads() const { return _workers.size() + 1; };
+
+  /// Return the number of dataset evaluations.
+  std::size_t evaluations() const {
+    std::lock_guard<std::mutex> lock(_call_mutex);
+    return _n_evaluated;
+  };
+
+  /// Return the number of dataset evaluations skipped (i.e., because none of
+  /// the dataset's parameters changed).
+  std::size_t skipped() const {
+    std::lock_guard<std::mutex> lock(_call_mutex);
+    return _n_skipped;
+  };
+
+  /// Reset the evaluation counters.
+  void reset_counters() {
+    std::lock_guard<std::mutex> lock(_call_mutex);
+    _n_evaluated = 0;
+    _n_skipped = 0;
+  };
+
+  /// Forget the cached chi2s (e.g., if the datasets have changed).
+  void clear() {
+    std::lock_guard<std::mutex> lock(_call_mutex);
+    std::fill(_value_valid.begin(), _value_valid.end(), 0);
+    std::fill(_gradient_valid.begin(), _gradient_valid.end(), 0);
+  };
+
+  /// Return true if every dataset provides its own gradient.
+  bool has_gradients() const {
+    return std::find(_chi2_gradient.begin(), _chi2_gradient.end(), nullptr) ==
+           _chi2_gradient.end();
+  };
+
+  /// Evaluate the gradient of the global chi2.
+  void Gradient(const double *par, double *grad) const override {
+    double chi2;
+    FdF(par, chi2, grad);
+  };
+
+  /// Evaluate the global chi2 and its gradient together.
+  void FdF(const double *par, double &chi2, double *grad) const override {
+    std::lock_guard<std::mutex> lock(_call_mutex);
+    chi2 = evaluate_gradient(par, grad);
+  };
+
+private:
+  /// global chi2 for a given set of fit parameters
+  double DoEval(const double *par) const override {
+    std::lock_guard<std::mutex> lock(_call_mutex);
+    dispatch(par, false);
+    return sum();
+  };
+
+  /// derivative of the global chi2 with respect to par[i]
+  double DoDerivative(const double *par, unsigned int i) const override {
+    // (the buffer is shared, so it is read before the lock is released)
+    std::lock_guard<std::mutex> lock(_call_mutex);
+    evaluate_gradient(par, _global_gradient.data());
+    return _global_gradient[i];
+  };
+
+  /// global chi2 & its gradient (n.b., the caller holds _call_mutex)
+  double evaluate_gradient(const double *par, double *grad) const {
+    dispatch(par, true);
+    // scatter the datasets' gradients, in dataset order
+    std::fill(grad, grad + _n_dim, 0.0);
+    for (std::size_t k = 0; k < _index.size(); ++k) {
+      grad[_index[k]] += _gradient[k];
+    }
+    return sum();
+  };
+
+  /// allocate the buffers & start the worker threads
+  void allocate() {
+    _parameters.resize(_index.size());
+    _gradient.resize(_index.size());
+    _values.resize(_chi2.size());
+    _value_valid.assign(_chi2.size(), 0);
+    _gradient_valid.assign(_chi2.size(), 0);
+    _dirty.reserve(_chi2.size());
+    _global_gradient.resize(_n_dim);
+    const std::size_t n_workers =
+        std::min<std::size_t>(_n_threads, std::max<std::size_t>(1, size())) -
+        1;
+    for (std::size_t w = 0; w < n_workers; ++w) {
+      _workers.emplace_back([this]() { work(); });
+    }
+  };
+
+  /// sum of the datasets' chi2s (in dataset order)
+  double sum() const {
+    double global_chi2 = 0.0;
+    for (double value : _values) {
+      global_chi2 += value;
+    }
+    return global_chi2;
+  };
+
+  /// evaluate all of the (changed) datasets, using every thread
+  void dispatch(const double *par, bool with_gradient) const {
+    // gather each dataset's parameters, noting those that have changed
+    _dirty.clear();
+    for (std::size_t i = 0; i < size(); ++i) {
+      double *p = _parameters.data() + _offset[i];
+      bool changed = false;
+      for (std::size_t k = _offset[i]; k < _offset[i + 1]; ++k, ++p) {
+        const double value = par[_index[k]];
+        if (not(*p == value)) {
+          changed = true;
+          *p = value;
+        }
+      }
+      if (changed) {
+        _value_valid[i] = 0;
+        _gradient_valid[i] = 0;
+      }
+      if (with_gradient ? _gradient_valid[i] : _value_valid[i]) {
+        ++_n_skipped;
+      } else {
+        _dirty.push_back(i);
+        ++_n_evaluated;
+      }
+    }
+    _with_gradient = with_gradient;
+    _exception = nullptr;
+    _next.store(0);
+    // (a single dataset is evaluated by the calling thread only)
+    const bool parallel = not _workers.empty() and _dirty.size() > 1;
+    if (parallel) {
+      {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _busy = _workers.size();
+        ++_generation;
+      }
+      _start.notify_all();
+    }
+    run();
+    if (parallel) {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _done.wait(lock, [this]() { return _busy == 0; });
+    }
+    if (_exception) {
+      std::rethrow_exception(_exception);
+    }
+  };
+
+  /// worker thread loop
+  void work() const {
+    std::size_t generation = 0;
+    for (;;) {
+      {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _start.wait(lock, [&]() { return _stop or _generation != generation; });
+        if (_stop) {
+          return;
+        }
+        generation = _generation;
+      }
+      run();
+      std::lock_guard<std::mutex> lock(_mutex);
+      if (--_busy == 0) {
+        _done.notify_one();
+      }
+    }
+  };
+
+  /// evaluate (changed) datasets until there are none left
+  void run() const {
+    for (std::size_t k = _next++; k < _dirty.size(); k = _next++) {
+      try {
+        evaluate(_dirty[k]);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (not _exception) {
+          _exception = std::current_exception();
+        }
+      }
+    }
+  };
+
+  /// evaluate the chi2 (and gradient) of dataset i
+  void evaluate(std::size_t i) const {
+    const std::size_t n = _offset[i + 1] - _offset[i];
+    double *p = _parameters.data() + _offset[i];
+    if (not _with_gradient) {
+      _values[i] = (*_chi2[i])(p);
+      _value_valid[i] = 1;
+      return;
+    }
+    double *g = _gradient.data() + _offset[i];
+    if (_chi2_gradient[i] != nullptr) {
+      _chi2_gradient[i]->FdF(p, _values[i], g);
+      _value_valid[i] = 1;
+      _gradient_valid[i] = 1;
+      return;
+    }
+    // central differences w.r.t. the dataset's own parameters
+    _values[i] = (*_chi2[i])(p);
+    for (std::size_t k = 0; k < n; ++k) {
+      const double p_k = p[k];
+      const double h = std::cbrt(std::numeric_limits<double>::epsilon()) *
+                       std::max(1.0, std::abs(p_k));
+      p[k] = p_k + h;
+      const double chi2_plus = (*_chi2[i])(p);
+      p[k] = p_k - h;
+      const double chi2_minus = (*_chi2[i])(p);
+      p[k] = p_k;
+      g[k] = (chi2_plus - chi2_minus) / (2.0 * h);
+    }
+    _value_valid[i] = 1;
+    _gradient_valid[i] = 1;
+  };
+
+  /// holder of the individual chi2 functions (and their gradients, if any)
+  std::vector<const ROOT::Math::IMultiGenFunction *> _chi2;
+  std::vector<const ROOT::Math::IMultiGradFunction *> _chi2_gradient;
+  /// flat parameter index (dataset i uses _index[_offset[i]:_offset[i + 1]])
+  std::vector<std::size_t> _offset;
+  std::vector<int> _index;
+  /// number of global fit parameters
+  unsigned int _n_dim;
+  /// (requested) number of threads
+  unsigned int _n_threads;
+  /// each dataset's parameters, chi2 & gradient (from its last evaluation)
+  mutable std::vector<double> _parameters;
+  mutable std::vector<double> _values;
+  mutable std::vector<double> _gradient;
+  /// flags for the above being up to date (n.b., not std::vector<bool>,
+  /// whose elements can't be written concurrently)
+  mutable std::vector<char> _value_valid;
+  mutable std::vector<char> _gradient_valid;
+  /// datasets to evaluate in the current call
+  mutable std::vector<std::size_t> _dirty;
+  /// evaluation counters
+  mutable std::size_t _n_evaluated = 0;
+  mutable std::size_t _n_skipped = 0;
+  /// buffer for DoDerivative
+  mutable std::vector<double> _global_gradient;
+  /// the current call's mode
+  mutable bool _with_gradient = false;
+  /// the first exception thrown by a dataset (rethrown by the caller)
+  mutable std::exception_ptr _exception;
+  /// worker threads & their synchronization
+  std::vector<std::thread> _workers;
+  mutable std::atomic<std::size_t> _next{0};
+  mutable std::size_t _busy = 0;
+  mutable std::size_t _generation = 0;
+  bool _stop = false;
+  mutable std::mutex _mutex;
+  mutable std::condition_variable _start;
+  mutable std::condition_variable _done;
+  /// serializes concurrent calls
+  mutable std::mutex _call_mutex;
+}; //  class parallel_global_chi2
+
 } // namespace triumf
 
 #endif // TRIUMF_GLOBAL_CHI2_HPP
@@ -0,0 +1,266 @@
+#ifndef TRIUMF_INSTRUMENTATION_HPP
+#define TRIUMF_INSTRUMENTATION_HPP
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// TRIUMF: Canada's particle accelerator centre
+namespace triumf {
+
+/// \brief Opt-in instrumentation of the numerical hot paths.
+/// \details The integrators (and root finders) at the library's most
+/// expensive call sites are wrapped in a Probe, which records the number of
+/// calls, the number of integrand evaluations (or iterations), the levels of
+/// refinement reached, the error estimates, and the cumulative (wall) time,
+/// per call site. The counters are kept per thread (such that recording
+/// never contends with other threads) and merged by snapshot().
+///
+/// Everything is compiled out unless TRIUMF_INSTRUMENTATION is defined
+/// (e.g., by compiling with -DTRIUMF_INSTRUMENTATION). Otherwise, the Probes
+/// are empty and the instrumented code is unchanged.
+///
+/// n.b., TRIUMF_INSTRUMENTATION must be defined (or not) consistently for the
+/// whole program. enabled, and hence the default Probe<T, Enabled = enabled>,
+/// differ between translation units compiled with and without it, while the
+/// (inline) instrumented templates have the same names in both: this violates
+/// the one definition rule, and the linker silently keeps one of the
+/// definitions. Calls from an instrumented translation unit may then record
+/// nothing, or mismatched definitions may be linked together. The same holds
+/// between a translation unit and libtriumfpp (see
+/// triumf/extern_templates.hpp), whose explicit instantiations are used
+/// instead of the translation unit's own, i.e., the library must be built
+/// with the same setting (e.g., make lib LIB_FLAGS="-O2 -fPIC
+/// -DTRIUMF_INSTRUMENTATION").
+namespace instrumentation {
+
+#ifdef TRIUMF_INSTRUMENTATION
+inline constexpr bool enabled = true;
+#else
+inline constexpr bool enabled = false;
+#endif
+
+/// number of refinement levels tallied separately (deeper levels are tallied
+/// in the last bin)
+inline constexpr std::size_t n_levels = 16;
+
+/// counters for a single call site
+struct Record {
+  /// number of calls
+  std::size_t calls = 0;
+  /// number of integrand evaluations (or iterations)
+  std::size_t evaluations = 0;
+  /// number of calls reaching each refinement level
+  std::array<std::size_t, n_levels> levels = {};
+  /// deepest refinement level reached
+  std::size_t max_level = 0;
+  /// sum & maximum of the (reported) error estimates
+  double error = 0.0;
+  double max_error = 0.0;
+  /// cumulative time (s)
+  double seconds = 0.0;
+
+  /// Accumulate the counters of another record.
+  Record &operator+=(const Record &other) {
+    calls += other.calls;
+    evaluations += other.evaluations;
+    for (std::size_t i = 0; i < n_levels; ++i) {
+      levels[i] += other.levels[i];
+    }
+    max_level = std::max(max_level, other.max_level);
+    error += other.error;
+    max_error = std::max(max_error, other.max_error);
+    seconds += other.seconds;
+    return *this;
+  };
+};
+
+/// records of all call sites, keyed by the call site's name
+typedef std::map<std::string, Record> Snapshot;
+
+namespace detail {
+
+/// a thread's counters (guarded, such that they can be read/reset by other
+/// threads, but only ever contended while doing so)
+struct ThreadCounters {
+  std::mutex mutex;
+  std::unordered_map<const char *, Record> records;
+};
+
+/// the counters of every thread that has recorded anything (these outlive
+/// their threads, such that nothing recorded is lost)
+struct Registry {
+  std::mutex mutex;
+  std::vector<std::shared_ptr<ThreadCounters>> threads;
+};
+
+inline Registry &registry() {
+  static Registry registry;
+  return registry;
+}
+
+/// Return the calling thread's counters, registering them upon first use.
+inline ThreadCounters &thread_counters() {
+  thread_local std::shared_ptr<ThreadCounters> counters = []() {
+    auto counters = std::make_shared<ThreadCounters>();
+    Registry &r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    r.threads.push_back(counters);
+    return counters;
+  }();
+  return *counters;
+}
+
+} // namespace detail
+
+/// Record a single call of the given call site.
+inline void record(const char *site, std::size_t evaluations,
+                   std::size_t level, double error, double seconds) {
+  detail::ThreadCounters &counters = detail::thread_counters();
+  std::lock_guard<std::mutex> lock(counters.mutex);
+  Record &r = counters.records[site];
+  r.calls += 1;
+  r.evaluations += evaluations;
+  r.levels[std::min(level, n_levels - 1)] += 1;
+  r.max_level = std::max(r.max_level, level);
+  r.error += error;
+  r.max_error = std::max(r.max_error, error);
+  r.seconds += seconds;
+}
+
+/// Return the counters of every call site, summed over all threads.
+inline Snapshot snapshot() {
+  Snapshot result;
+  detail::Registry &r = detail::registry();
+  std::lock_guard<std::mutex> registry_lock(r.mutex);
+  for (const auto &counters : r.threads) {
+    std::lock_guard<std::mutex> lock(counters->mutex);
+    for (const auto &[site, record] : counters->records) {
+      result[site] += record;
+    }
+  }
+  return result;
+}
+
+/// Reset the counters (of all threads).
+inline void reset() {
+  detail::Registry &r = detail::registry();
+  std::lock_guard<std::mutex> registry_lock(r.mutex);
+  for (const auto &counters : r.threads) {
+    std::lock_guard<std::mutex> lock(counters->mutex);
+    counters->records.clear();
+  }
+}
+
+/// Write a snapshot as JSON (an object keyed by call site).
+inline void dump_json(std::ostream &os, const Snapshot &records) {
+  os << "{";
+  bool first = true;
+  for (const auto &[site, record] : records) {
+    os << (first ? "" : ",") << "\n  \"" << site << "\": {"
+       << "\"calls\": " << record.calls
+       << ", \"evaluations\": " << record.evaluations << ", \"levels\": [";
+    for (std::size_t i = 0; i <= std::min(record.max_level, n_levels - 1);
+         ++i) {
+      os << (i > 0 ? ", " : "") << record.levels[i];
+    }
+    os << "], \"max_level\": " << record.max_level
+       << ", \"mean_error\": " << record.error / record.calls
+       << ", \"max_error\": " << record.max_error
+       << ", \"seconds\": " << record.seconds << "}";
+    first = false;
+  }
+  os << (first ? "}" : "\n}") << "\n";
+}
+
+/// Write the current counters as JSON.
+inline void dump_json(std::ostream &os) { dump_json(os, snapshot()); }
+
+/// Return the current counters as JSON.
+inline std::string to_json() {
+  std::ostringstream os;
+  dump_json(os);
+  return os.str();
+}
+
+/// \brief Scoped probe of a single call of an instrumented call site.
+/// \details The integrand is wrapped by counted() and the integrator's error
+/// estimate & levels are written to error() & levels() (which are null when
+/// the instrumentation is disabled, i.e., the integrator's defaults). The
+/// call is recorded (and timed) upon destruction. The call site's name must
+/// be a string literal.
+template <typename T = double, bool Enabled = enabled> class Probe {
+public:
+  /// constructor.
+  explicit Probe(const char *site)
+      : _site(site), _start(std::chrono::steady_clock::now()){};
+
+  Probe(const Probe &) = delete;
+  Probe &operator=(const Probe &) = delete;
+
+  /// destructor (records the call).
+  ~Probe() {
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - _start;
+    try {
+      record(_site, _evaluations, _levels, static_cast<double>(_error),
+             elapsed.count());
+    } catch (...) {
+      // (instrumentation must never alter the results)
+    }
+  };
+
+  /// Return a function counting the evaluations of f (held by value).
+  template <typename F> auto counted(F f) {
+    return [this, f = std::move(f)](const auto &x) -> decltype(f(x)) {
+      ++_evaluations;
+      return f(x);
+    };
+  };
+
+  /// Add to the number of evaluations (or iterations).
+  void add_evaluations(std::size_t n) { _evaluations += n; };
+
+  /// Set the error estimate.
+  void set_error(T error) { _error = error; };
+
+  /// Return the storage for the integrator's error estimate.
+  T *error() { return &_error; };
+
+  /// Return the storage for the integrator's number of levels.
+  std::size_t *levels() { return &_levels; };
+
+private:
+  const char *_site;
+  std::chrono::steady_clock::time_point _start;
+  std::size_t _evaluations = 0;
+  std::size_t _levels = 0;
+  T _error = 0;
+};
+
+/// disabled probe (i.e., nothing is recorded)
+template <typename T> class Probe<T, false> {
+public:
+  explicit Probe(const char *){};
+  template <typename F> F counted(F f) { return f; };
+  void add_evaluations(std::size_t) {};
+  void set_error(T) {};
+  T *error() { return nullptr; };
+  std::size_t *levels() { return nullptr; };
+};
+
+} // namespace instrumentation
+
+} // namespace triumf
+
+#endif // TRIUMF_INSTRUMENTATION_HPP
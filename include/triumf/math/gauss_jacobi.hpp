@@ -0,0 +1,189 @@
+#ifndef TRIUMF_MATH_GAUSS_JACOBI_HPP
+#define TRIUMF_MATH_GAUSS_JACOBI_HPP
+
+// C++ standard library headers
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+// Boost headers
+#include <boost/math/special_functions/beta.hpp>
+
+// TRIUMF: Canada's particle accelerator centre
+namespace triumf {
+
+//
+namespace math {
+
+// numerical quadrature
+namespace quadrature {
+
+/// \brief n-point Gauss-Jacobi quadrature rule.
+/// \details Approximates the integral of f(x) (1 - x)^a (1 + x)^b over
+/// [-1, 1], exactly for polynomials f of degree up to 2n - 1. The nodes and
+/// weights are found with the Golub-Welsch algorithm (i.e., from the
+/// eigensystem of the Jacobi matrix of the three-term recurrence), which is
+/// robust for any a, b > -1.
+template <typename T = double> class gauss_jacobi {
+public:
+  /// constructor.
+  gauss_jacobi(std::size_t n, T a, T b) : _a(a), _b(b) {
+    if (n == 0) {
+      throw std::domain_error(
+          "triumf::math::quadrature::gauss_jacobi: n must be positive");
+    }
+    if (not(a > -1.0) or not(b > -1.0)) {
+      throw std::domain_error(
+          "triumf::math::quadrature::gauss_jacobi: a, b must be > -1");
+    }
+    golub_welsch(n);
+  };
+
+  /// Return the quadrature nodes (in ascending order).
+  const std::vector<T> &abscissa() const { return _abscissa; };
+
+  /// Return the quadrature weights (these sum to the integral of the weight
+  /// function over [-1, 1]).
+  const std::vector<T> &weights() const { return _weights; };
+
+  /// Return the number of nodes.
+  std::size_t size() const { return _abscissa.size(); };
+
+  /// Return the exponent of (1 - x).
+  T a() const { return _a; };
+
+  /// Return the exponent of (1 + x).
+  T b() const { return _b; };
+
+  /// Integrate f(x) (1 - x)^a (1 + x)^b over [-1, 1].
+  template <typename F> T integrate(F f) const {
+    T sum = 0.0;
+    for (std::size_t i = 0; i < _abscissa.size(); ++i) {
+      sum += _weights[i] * f(_abscissa[i]);
+    }
+    return sum;
+  };
+
+private:
+  /// Golub-Welsch algorithm
+  void golub_welsch(std::size_t n) {
+    const T ab = _a + _b;
+    // the Jacobi matrix: diagonal...
+    std::vector<T> d(n);
+    d[0] = (_b - _a) / (ab + 2.0);
+    for (std::size_t k = 1; k < n; ++k) {
+      const T s = 2.0 * k + ab;
+      d[k] = (_b * _b - _a * _a) / (s * (s + 2.0));
+    }
+    // ...and sub-diagonal (e[k] couples k & k + 1)
+    std::vector<T> e(n, 0.0);
+    if (n > 1) {
+      e[0] = std::sqrt(4.0 * (1.0 + _a) * (1.0 + _b) /
+                       ((2.0 + ab) * (2.0 + ab) * (3.0 + ab)));
+    }
+    for (std::size_t k = 2; k < n; ++k) {
+      const T s = 2.0 * k + ab;
+      e[k - 1] = std::sqrt(4.0 * k * (k + _a) * (k + _b) * (k + ab) /
+                           (s * s * (s + 1.0) * (s - 1.0)));
+    }
+    // first components of the (normalized) eigenvectors
+    std::vector<T> z(n, 0.0);
+    z[0] = 1.0;
+    implicit_ql(d, e, z);
+    // integral of the weight function over [-1, 1]
+    const T mu_0 = std::pow(T(2.0), ab + 1.0) *
+                   boost::math::beta<T>(_a + 1.0, _b + 1.0);
+    // sort the nodes
+    std::vector<std::size_t> index(n);
+    std::iota(index.begin(), index.end(), 0);
+    std::sort(index.begin(), index.end(),
+              [&d](std::size_t i, std::size_t j) { return d[i] < d[j]; });
+    _abscissa.resize(n);
+    _weights.resize(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      _abscissa[i] = d[index[i]];
+      _weights[i] = mu_0 * z[index[i]] * z[index[i]];
+    }
+  };
+
+  /// eigenvalues of a symmetric tridiagonal matrix (implicit QL with Wilkinson
+  /// shifts), keeping track of the first row of the eigenvector matrix only
+  static void implicit_ql(std::vector<T> &d, std::vector<T> &e,
+                          std::vector<T> &z) {
+    const std::size_t n = d.size();
+    const int max_iterations = 60;
+    for (std::size_t l = 0; l < n; ++l) {
+      int iteration = 0;
+      std::size_t m;
+      do {
+        for (m = l; m + 1 < n; ++m) {
+          const T dd = std::abs(d[m]) + std::abs(d[m + 1]);
+          if (std::abs(e[m]) <= std::numeric_limits<T>::epsilon() * dd) {
+            break;
+          }
+        }
+        if (m != l) {
+          if (iteration++ == max_iterations) {
+            throw std::runtime_error(
+                "triumf::math::quadrature::gauss_jacobi: no convergence");
+          }
+          T g = (d[l + 1] - d[l]) / (2.0 * e[l]);
+          T r = std::hypot(g, T(1.0));
+          g = d[m] - d[l] + e[l] / (g + std::copysign(r, g));
+          T s = 1.0;
+          T c = 1.0;
+          T p = 0.0;
+          bool underflow = false;
+          for (std::size_t i = m; i-- > l;) {
+            T f = s * e[i];
+            const T b = c * e[i];
+            r = std::hypot(f, g);
+            e[i + 1] = r;
+            if (r == 0.0) {
+              d[i + 1] -= p;
+              e[m] = 0.0;
+              underflow = true;
+              break;
+            }
+            s = f / r;
+            c = g / r;
+            g = d[i + 1] - p;
+            r = (d[i] - g) * s + 2.0 * c * b;
+            p = s * r;
+            d[i + 1] = g + p;
+            g = c * r - b;
+            // apply the rotation to the eigenvector components
+            f = z[i + 1];
+            z[i + 1] = s * z[i] + c * f;
+            z[i] = c * z[i] - s * f;
+          }
+          if (underflow) {
+            continue;
+          }
+          d[l] -= p;
+          e[l] = g;
+          e[m] = 0.0;
+        }
+      } while (m != l);
+    }
+  };
+
+  /// exponents of the weight function
+  T _a;
+  T _b;
+  /// nodes & weights
+  std::vector<T> _abscissa;
+  std::vector<T> _weights;
+};
+
+} // namespace quadrature
+
+} // namespace math
+
+} // namespace triumf
+
+#endif // TRIUMF_MATH_GAUSS_JACOBI_HPP
@@ -26,11 +26,12 @@ template <typename T> T j(T omega, T nu_c) {
 //   p. 121, Tab. 4.6.
 // - A. Abragram, Ch. VIII, p. 295 (but with different numerical factors)?
 template <typename T> T slr_rate(T B_0, T B_d, T nu_c, T gamma_I, T gamma_S) {
+  using std::abs;
   // NMR frequencies
   T omega_I = gamma_I * B_0;
   T omega_S = gamma_S * B_0;
   // make sure the "coupling" term isn't negative
-  return std::abs(gamma_I * gamma_S) * B_d * B_d *
+  return abs(gamma_I * gamma_S) * B_d * B_d *
          ((1.0 / 3.0) * j<T>(omega_I - omega_S, nu_c) +
           (1.0 / 1.0) * j(omega_I, nu_c) +
           (2.0 / 1.0) * j<T>(omega_I + omega_S, nu_c));
@@ -1,13 +1,20 @@
 #ifndef TRIUMF_NMR_HEBEL_SLICHTER_HPP
 #define TRIUMF_NMR_HEBEL_SLICHTER_HPP
 
+#include <algorithm>
 #include <cmath>
 #include <complex>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <vector>
 
+#include <boost/math/constants/constants.hpp>
 #include <boost/math/quadrature/exp_sinh.hpp>
 #include <boost/math/quadrature/gauss_kronrod.hpp>
 
 #include <triumf/constants/codata_2018.hpp>
+#include <triumf/instrumentation.hpp>
 #include <triumf/statistical_mechanics/fermi_dirac.hpp>
 #include <triumf/superconductivity/bcs.hpp>
 #include <triumf/superconductivity/dynes.hpp>
@@ -40,13 +47,14 @@ T integrand(T energy, T temperature, T critical_temperature, T gap_meV, T alpha,
   T f_E_p = triumf::statistical_mechanics::fermi_dirac::distribution<T>(
       temperature, E_p * 1e-3, E_0, E_F);
 
+  // density of states & coherence factors
+  T N, M, N_p, M_p;
+  triumf::superconductivity::dynes::N_M<T>(E, Gamma * gap_meV, Delta, N, M);
+  triumf::superconductivity::dynes::N_M<T>(E_p, Gamma * gap_meV, Delta, N_p,
+                                           M_p);
+
   //
-  return (triumf::superconductivity::dynes::N(E, Gamma * gap_meV, Delta) *
-              triumf::superconductivity::dynes::N(E_p, Gamma * gap_meV, Delta) +
-          triumf::superconductivity::dynes::M(E, Gamma * gap_meV, Delta) *
-              triumf::superconductivity::dynes::M(E_p, Gamma * gap_meV,
-                                                  Delta)) *
-         f_E * (1.0 - f_E_p);
+  return (N * N_p + M * M_p) * f_E * (1.0 - f_E_p);
 }
 
 // ratio of SLR rates in the superconducting and normal states
@@ -81,9 +89,11 @@ T slr_ratio(T temperature, T critical_temperature, T gap_meV, T alpha,
 
     const std::size_t max_refinements = 15;
     static boost::math::quadrature::exp_sinh<T> hs_integrator(max_refinements);
+    triumf::instrumentation::Probe<T> probe(
+        "triumf::nmr::hebel_slichter::slr_ratio");
     return 2.0 * beta *
-           hs_integrator.integrate(hs_integrand, tolerance, nullptr, nullptr,
-                                   nullptr);
+           hs_integrator.integrate(probe.counted(hs_integrand), tolerance,
+                                   probe.error(), nullptr, probe.levels());
     /*
     const unsigned max_depth = 15;
     return 2.0 * beta *
@@ -94,6 +104,207 @@ T slr_ratio(T temperature, T critical_temperature, T gap_meV, T alpha,
   }
 }
 
+/// \brief Ratio of SLR rates, tabulated over many temperatures.
+/// \details Evaluates the same integral as slr_ratio, but on a fixed set of
+/// (double exponential) quadrature nodes that is computed once, upon
+/// construction, and shared by all temperatures. The integral is split at
+/// the energies where N(E) or N(E') is (nearly) singular, E = Delta(T) and
+/// E = Delta(T) - alpha gap_meV:
+///
+///   [E_j, E_j+1]: E = E_j + (E_j+1 - E_j) v, with tanh-sinh nodes v in (0, 1);
+///   [E_max, ∞):   E = E_max + k_B T x, with exp-sinh nodes x in (0, ∞);
+///
+/// such that the nodes cluster on either side of the coherence peak(s) for
+/// every temperature. For each temperature, the gap is looked up once and
+/// the Fermi factors, N(E), and M(E) are evaluated for all nodes in simple
+/// (vectorizable) loops over contiguous arrays, with the Dynes density of
+/// states in real arithmetic (see dynes::N_M).
+template <typename T = double> class SlrRatio {
+public:
+  /// \brief constructor.
+  /// \param critical_temperature the critical temperature T_c (K).
+  /// \param gap_meV the energy gap at absolute zero (meV).
+  /// \param alpha the energy transferred to the nucleus (units of gap_meV).
+  /// \param Gamma the Dynes broadening (units of gap_meV).
+  /// \param step the step size of the quadrature nodes (the number of nodes
+  /// is inversely proportional to it).
+  SlrRatio(T critical_temperature, T gap_meV, T alpha, T Gamma,
+           T step = 1.0 / 16.0)
+      : _critical_temperature(critical_temperature), _gap_meV(gap_meV),
+        _alpha(alpha), _Gamma(Gamma) {
+    if (not(step > 0.0) or not(step <= 1.0)) {
+      throw std::domain_error(
+          "triumf::nmr::hebel_slichter::SlrRatio: invalid step size");
+    }
+    using std::cosh;
+    using std::exp;
+    using std::sinh;
+    using std::sqrt;
+    const T epsilon = std::numeric_limits<T>::epsilon();
+    const T half_pi = boost::math::constants::half_pi<T>();
+    // nodes beyond which the (weighted) integrand is negligible, including a
+    // possible inverse square root singularity at the gap
+    const T cutoff = 1e-3 * epsilon;
+    // tanh-sinh: v = (1 + tanh(s)) / 2, with s = π/2 sinh(t)
+    for (int sign : {1, -1}) {
+      for (int k = sign > 0 ? 0 : -1;; k += sign) {
+        const T t = k * step;
+        const T s = half_pi * sinh(t);
+        const T v = 1.0 / (1.0 + exp(-2.0 * s));
+        const T one_minus_v = 1.0 / (1.0 + exp(2.0 * s));
+        const T weight = 0.5 * step * half_pi * cosh(t) / (cosh(s) * cosh(s));
+        if (not(weight * sqrt(std::min(v, one_minus_v)) > cutoff)) {
+          break;
+        }
+        _v.push_back(v);
+        _one_minus_v.push_back(one_minus_v);
+        _v_weight.push_back(weight);
+      }
+    }
+    // exp-sinh: x = exp(π/2 sinh(t)), with the integrand decaying (at least)
+    // as exp(-x) for large x
+    for (int sign : {1, -1}) {
+      for (int k = sign > 0 ? 0 : -1;; k += sign) {
+        const T t = k * step;
+        const T x = exp(half_pi * sinh(t));
+        const T weight = step * half_pi * cosh(t) * x;
+        if (not(weight * std::min(exp(-x), T(1.0) / sqrt(x)) > cutoff)) {
+          break;
+        }
+        _x.push_back(x);
+        _x_weight.push_back(weight);
+      }
+    }
+  };
+
+  /// Return the ratio of the SLR rates at the given temperature (K).
+  T operator()(T temperature) const {
+    Workspace workspace(*this);
+    return evaluate(temperature, workspace);
+  };
+
+  /// Return the ratio of the SLR rates at each temperature (K).
+  void operator()(const std::vector<T> &temperature,
+                  std::vector<T> &ratio) const {
+    ratio.resize(temperature.size());
+    Workspace workspace(*this);
+    for (std::size_t i = 0; i < temperature.size(); ++i) {
+      ratio[i] = evaluate(temperature[i], workspace);
+    }
+  };
+
+  /// Return the ratio of the SLR rates at each temperature (K).
+  std::vector<T> operator()(const std::vector<T> &temperature) const {
+    std::vector<T> ratio;
+    (*this)(temperature, ratio);
+    return ratio;
+  };
+
+  /// Return the number of (shared) quadrature nodes.
+  std::size_t size() const { return _v.size() + _x.size(); };
+
+private:
+  /// largest number of energy nodes for a single temperature (i.e., with two
+  /// finite intervals below the gap)
+  std::size_t capacity() const { return 2 * _v.size() + _x.size(); };
+
+  /// scratch arrays (one value per node)
+  struct Workspace {
+    explicit Workspace(const SlrRatio &engine)
+        : energy(engine.capacity()), distance(engine.capacity()),
+          weight(engine.capacity()), integrand(engine.capacity()){};
+    /// E and E - Delta
+    std::vector<T> energy;
+    std::vector<T> distance;
+    /// quadrature weight (including the Jacobian)
+    std::vector<T> weight;
+    /// (N N' + M M') f(E) (1 - f(E'))
+    std::vector<T> integrand;
+  };
+
+  /// ratio of the SLR rates at a single temperature
+  T evaluate(T temperature, Workspace &workspace) const {
+    using std::exp;
+    if (temperature <= 0.0) {
+      return 0.0;
+    }
+    const T k_B =
+        1e3 *
+        triumf::constants::codata_2018::Boltzmann_constant_in_eV_K<T>::value();
+    const T k_B_T = k_B * temperature;
+    const T beta = 1.0 / k_B_T;
+    const T Delta = triumf::superconductivity::bcs::gap<T>(
+        temperature, _critical_temperature, _gap_meV);
+    const T Gamma = _Gamma * _gap_meV;
+    const T shift = _alpha * _gap_meV;
+    // split the integral where N(E) or N(E') is (nearly) singular, i.e., at
+    // E = Delta and E' = Delta
+    T breakpoints[3] = {0.0, Delta, Delta - shift};
+    std::sort(breakpoints + 1, breakpoints + 3);
+    // map the (shared) nodes onto the energy axis
+    T *E = workspace.energy.data();
+    T *d = workspace.distance.data();
+    T *w = workspace.weight.data();
+    std::size_t n = 0;
+    T lower = breakpoints[0];
+    for (std::size_t j = 1; j < 3; ++j) {
+      const T upper = breakpoints[j];
+      if (not(upper > lower)) {
+        continue;
+      }
+      // measure from the nearest end of the interval, where the nodes
+      // cluster, to keep E - Delta accurate close to the gap
+      const T length = upper - lower;
+      for (std::size_t i = 0; i < _v.size(); ++i, ++n) {
+        const bool left = _v[i] < 0.5;
+        const T offset = left ? length * _v[i] : -length * _one_minus_v[i];
+        E[n] = (left ? lower : upper) + offset;
+        d[n] = ((left ? lower : upper) - Delta) + offset;
+        w[n] = length * _v_weight[i];
+      }
+      lower = upper;
+    }
+    for (std::size_t i = 0; i < _x.size(); ++i, ++n) {
+      E[n] = lower + k_B_T * _x[i];
+      d[n] = (lower - Delta) + k_B_T * _x[i];
+      w[n] = k_B_T * _x_weight[i];
+    }
+    // the integrand at all nodes
+    T *y = workspace.integrand.data();
+    for (std::size_t i = 0; i < n; ++i) {
+      const T E_p = E[i] + shift;
+      // Re[z / sqrt(z^2 - Delta^2)] & Re[Delta / sqrt(z^2 - Delta^2)], with
+      // z = E - i Gamma, for E and E'
+      T N, M, N_p, M_p;
+      triumf::superconductivity::dynes::N_M<T>(E[i], d[i], Gamma, Delta, N, M);
+      triumf::superconductivity::dynes::N_M<T>(E_p, d[i] + shift, Gamma, Delta,
+                                               N_p, M_p);
+      // f(E) (1 - f(E'))
+      const T f_E = 1.0 / (exp(beta * E[i]) + 1.0);
+      const T f_E_p = 1.0 / (exp(-beta * E_p) + 1.0);
+      y[i] = w[i] * (N * N_p + M * M_p) * f_E * f_E_p;
+    }
+    T sum = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+      sum += y[i];
+    }
+    return 2.0 * beta * sum;
+  };
+
+  /// superconducting parameters
+  T _critical_temperature;
+  T _gap_meV;
+  T _alpha;
+  T _Gamma;
+  /// tanh-sinh nodes v & 1 - v (in (0, 1)) and their weights
+  std::vector<T> _v;
+  std::vector<T> _one_minus_v;
+  std::vector<T> _v_weight;
+  /// exp-sinh nodes x (in (0, ∞)) and their weights
+  std::vector<T> _x;
+  std::vector<T> _x_weight;
+};
+
 } // namespace hebel_slichter
 
 } // namespace nmr
@@ -27,8 +27,15 @@
 // 434-438 (1994). https://dx.doi.org/10.1016/0167-2738(94)90350-6
 //
 
+#include <algorithm>
 #include <cmath>
+#include <complex>
+#include <cstddef>
 #include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 #include <boost/math/constants/constants.hpp>
 
@@ -66,6 +73,28 @@ T nu_c(T temperature, T prefactor, T activation_energy) {
   }
 }
 
+// Arrhenius correlation time (for each temperature)
+template <typename T = double>
+std::vector<T> tau_c(const std::vector<T> &temperature, T prefactor,
+                     T activation_energy) {
+  std::vector<T> result(temperature.size());
+  for (std::size_t i = 0; i < temperature.size(); ++i) {
+    result[i] = tau_c<T>(temperature[i], prefactor, activation_energy);
+  }
+  return result;
+}
+
+// Arrhenius correlation rate (for each temperature)
+template <typename T = double>
+std::vector<T> nu_c(const std::vector<T> &temperature, T prefactor,
+                    T activation_energy) {
+  std::vector<T> result(temperature.size());
+  for (std::size_t i = 0; i < temperature.size(); ++i) {
+    result[i] = nu_c<T>(temperature[i], prefactor, activation_energy);
+  }
+  return result;
+}
+
 // Bloembergen-Purcell-Pound (i.e., Debye) - isotropic 3D fluctuations
 template <typename T = double>
 T j_3d(T correlation_time, T nmr_frequency, T interaction_strength,
@@ -219,21 +248,9 @@ T j_hn(T correlation_time, T nmr_frequency, T interaction_strength, T delta,
              -epsilon / 2.0);
 }
 
-// Bryn-Mawr
-// double j_bm(double correlation_time, double nmr_frequency, double
-// interaction_strength = 1, double epsilon = 1, double eta = 1);
-
-// Wagner (i.e., log-Gaussian)
-// double j_lg(double correlation_time, double nmr_frequency, double
-// interaction_strength = 1, double width = 1);
-
-// log-Lorentzian
-// double j_ll(double correlation_time, double nmr_frequency, double
-// interaction_strength = 1, double width = 1);
-
-// Frolich (i.e., energy box)
-// double j_eb(double correlation_time, double nmr_frequency, double
-// interaction_strength = 1, ...);
+// Bryn-Mawr, Wagner (i.e., log-Gaussian), log-Lorentzian, and Frolich (i.e.,
+// energy box) distributions of correlation times: see j_bm, j_lg, j_ll, and
+// j_eb (below)
 
 // Power law : power = 1 (e.g., Korringa); power = 2 (e.g., phonon); power = 3
 // (e.g., [Dirac] orbital)
@@ -248,6 +265,534 @@ T j_pow(T temperature, T intercept, T constant, T power) {
   return intercept + constant * std::pow(temperature, power);
 }
 
+/// \brief BPP spectral density averaged over a distribution of correlation
+/// times.
+/// \details For a (normalized) distribution G(s) of s = ln(τ / τ_c),
+///
+///   J(ω) = ∫ G(s) 2 τ_c e^s / (1 + (ω τ_c e^s)^2) ds,
+///
+/// which is evaluated with the trapezoidal rule on a fixed, uniform s-grid.
+/// As the integrand is smooth (i.e., analytic within a strip about the real
+/// axis), this converges exponentially with the number of nodes. Both e^s and
+/// G(s) ds are tabulated once, upon construction, such that each evaluation
+/// is a sum of rational terms (without any transcendental functions), which
+/// the compiler can vectorize.
+template <typename T = double> class DistributedSpectralDensity {
+public:
+  /// constructor (without any nodes, i.e., J = 0).
+  DistributedSpectralDensity() = default;
+
+  /// \brief constructor.
+  /// \param distribution the distribution G(s) of s = ln(τ / τ_c).
+  /// \param s_min the lower limit of the s-grid.
+  /// \param s_max the upper limit of the s-grid.
+  /// \param step the (maximum) spacing of the s-grid.
+  template <typename Distribution>
+  DistributedSpectralDensity(Distribution distribution, T s_min, T s_max,
+                             T step) {
+    if (not(step > 0.0) or not(s_max >= s_min)) {
+      throw std::domain_error(
+          "triumf::nmr::DistributedSpectralDensity: invalid s-grid");
+    }
+    const std::size_t n =
+        static_cast<std::size_t>(std::ceil((s_max - s_min) / step));
+    const T h = n > 0 ? (s_max - s_min) / n : T(1.0);
+    for (std::size_t k = 0; k <= n; ++k) {
+      const T s = s_min + k * h;
+      // (the trapezoidal rule halves the end points)
+      const T weight = (k == 0 or k == n) and n > 0 ? 0.5 * h : h;
+      _scale.push_back(std::exp(s));
+      _weight.push_back(weight * distribution(s));
+    }
+  };
+
+  /// \brief Gaussian distribution of ln(τ), with standard deviation width.
+  /// \details The s-grid resolves both the Gaussian and the BPP spectral
+  /// density (i.e., sech(s + ln(ω τ_c)), with poles at ±iπ/2). It extends to
+  /// where the distribution is negligible (at machine precision), plus width^2
+  /// to cover the shift of the integrand's maximum far from ω τ_c = 1 (where
+  /// sech decays as exp(-|s + ln(ω τ_c)|)).
+  static DistributedSpectralDensity log_gaussian(T width) {
+    const T pi = boost::math::constants::pi<T>();
+    const T log_tolerance = std::log(10.0 / std::numeric_limits<T>::epsilon());
+    const T s_max = width * (std::sqrt(2.0 * log_tolerance) + width);
+    const T step = std::min<T>(pi * pi / log_tolerance,
+                               pi * width * std::sqrt(2.0 / log_tolerance));
+    const T norm = 1.0 / (width * std::sqrt(2.0 * pi));
+    return DistributedSpectralDensity(
+        [&](T s) { return norm * std::exp(-s * s / (2.0 * width * width)); },
+        -s_max, s_max, step);
+  };
+
+  /// \brief Bryn-Mawr distribution of ln(τ), i.e., the generalized gamma
+  /// distribution of u = τ / τ_c:
+  ///
+  ///   G(s) = η exp(ε s - e^(η s)) / Γ(ε / η),
+  ///
+  /// with ε > 0 the (power law) slope of its short-τ tail and η > 0 the
+  /// (stretched exponential) sharpness of its long-τ cutoff (ε = η = 1 is an
+  /// exponential distribution of u).
+  /// \details The s-grid extends to where the distribution (or the integrand
+  /// at ω τ_c << 1) is negligible at machine precision, and resolves both the
+  /// distribution (which is analytic for |Im(s)| < π / (2 η)) and the BPP
+  /// spectral density.
+  static DistributedSpectralDensity bryn_mawr(T epsilon, T eta) {
+    const T pi = boost::math::constants::pi<T>();
+    const T log_tolerance = std::log(10.0 / std::numeric_limits<T>::epsilon());
+    // the mode of G(s), about which ln(G(s) / G(mode)) is
+    // ε t - (ε / η) (e^(η t) - 1), with t = s - mode
+    const T mode = std::log(epsilon / eta) / eta;
+    // short-τ tail (where e^(η t) is negligible)
+    const T t_min = -(log_tolerance + epsilon / eta) / epsilon;
+    // long-τ cutoff (including the e^s of the integrand at ω τ_c << 1),
+    // by fixed-point iteration of
+    // (ε / η) (e^(η t) - 1) - (ε + 1) t = log_tolerance
+    T t_max = 0.0;
+    for (int i = 0; i < 8; ++i) {
+      t_max = std::log1p(eta * ((epsilon + 1.0) * t_max + log_tolerance) /
+                         epsilon) /
+              eta;
+    }
+    // (the trapezoidal rule's error is ~exp(-2π d / step), with d the
+    // half-width of the strip, i.e., min(π / 2, π / (2 η)))
+    const T step = pi * pi / (std::max<T>(1.0, eta) * log_tolerance);
+    const T log_norm = std::log(eta) - std::lgamma(epsilon / eta);
+    return DistributedSpectralDensity(
+        [&](T s) {
+          return std::exp(log_norm + epsilon * s - std::exp(eta * s));
+        },
+        mode + t_min, mode + t_max, step);
+  };
+
+  /// Return the spectral density for a single correlation time & frequency.
+  T operator()(T correlation_time, T nmr_frequency) const {
+    T j;
+    (*this)(&correlation_time, 1, nmr_frequency, &j);
+    return j;
+  };
+
+  /// Return the spectral density for n correlation times at a single
+  /// frequency.
+  void operator()(const T *correlation_time, std::size_t n, T nmr_frequency,
+                  T *j) const {
+    const T *c = _scale.data();
+    const T *w = _weight.data();
+    std::fill(j, j + n, T(0.0));
+    // (node by node, such that the inner loop over the correlation times
+    // vectorizes without reordering any sums)
+    for (std::size_t k = 0; k < _scale.size(); ++k) {
+      const T omega_c = nmr_frequency * c[k];
+      const T w_c = w[k] * c[k];
+      for (std::size_t i = 0; i < n; ++i) {
+        const T y = omega_c * correlation_time[i];
+        j[i] += w_c / (1.0 + y * y);
+      }
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+      j[i] *= 2.0 * correlation_time[i];
+    }
+  };
+
+  /// Return the number of nodes.
+  std::size_t size() const { return _scale.size(); };
+
+private:
+  /// e^s and G(s) ds at each node
+  std::vector<T> _scale;
+  std::vector<T> _weight;
+};
+
+namespace detail {
+
+/// \brief Real part of β(a + i b) = Σ_k (-1)^k / (a + i b + k).
+/// \details Uses the recurrence β(z) = 1 / z - β(z + 1) until |z| is large,
+/// followed by the asymptotic expansion
+///
+///   β(z) ~ 1 / (2 z) + Σ_k (2^2k - 1) B_2k / (2k z^2k).
+template <typename T = double> T real_nielsen_beta(T a, T b) {
+  // |z| beyond which the (truncated) expansion is accurate
+  const T large = std::numeric_limits<T>::digits > 53 ? 40.0 : 20.0;
+  T sum = 0.0;
+  T sign = 1.0;
+  while (a * a + b * b < large * large) {
+    sum += sign * a / (a * a + b * b);
+    sign = -sign;
+    a += 1.0;
+  }
+  // r = 1 / z & r^2
+  const std::complex<T> r(a / (a * a + b * b), -b / (a * a + b * b));
+  const std::complex<T> r2 = r * r;
+  // coefficients of r^2k, for k = 1, ..., 7
+  const T coefficients[] = {0.25,       -0.125,       0.25,      -17.0 / 16.0,
+                            31.0 / 4.0, -691.0 / 8.0, 5461.0 / 4.0};
+  std::complex<T> polynomial = 0.0;
+  for (int k = 6; k >= 0; --k) {
+    polynomial = polynomial * r2 + coefficients[k];
+  }
+  const std::complex<T> series = T(0.5) * r + r2 * polynomial;
+  return sum + sign * series.real();
+}
+
+} // namespace detail
+
+/// \brief Batch evaluation of the spectral density functions.
+/// \details The (model) parameters are validated once, upon construction,
+/// and any terms that depend only on the stretching exponent(s) (e.g.,
+/// sin(β π / 2) and cos(β π / 2) for Cole-Cole) are computed then too.
+/// Evaluation never prints anything: for an invalid parameter set, all
+/// values are zero (as for the scalar functions) and the reason is available
+/// from warning(), such that the caller can report it (once). The models are
+/// those of the scalar functions, written in terms of x = ω τ_c, with the
+/// model selected outside of the loops over the data. The distributions of
+/// correlation times are evaluated as:
+///
+///   j_lg, j_bm: trapezoidal rule on a fixed grid (see
+///               DistributedSpectralDensity);
+///   j_ll: (2 / π) Re[β(1/2 + (w - i ln(x)) / π)], with β the Nielsen beta
+///         function (i.e., the log-Lorentzian convolved with sech(ln(x)));
+///   j_eb: (2 / w) atan(sinh(w / 2) sech(ln(x))).
+template <typename T = double> class SpectralDensity {
+public:
+  /// spectral density function
+  enum class Model {
+    j_3d,
+    j_2d,
+    j_cc,
+    j_dc,
+    j_fang,
+    j_fk,
+    j_hn,
+    j_lg,
+    j_ll,
+    j_eb,
+    j_bm
+  };
+
+  /// \brief constructor.
+  /// \param model the spectral density function.
+  /// \param interaction_strength the (overall) interaction strength.
+  /// \param stretching_exponent the stretching exponent (delta for j_hn, the
+  /// width of the distribution of ln(τ) for j_lg, j_ll, and j_eb, and epsilon
+  /// for j_bm).
+  /// \param epsilon the second exponent (epsilon for j_hn and eta for j_bm).
+  SpectralDensity(Model model, T interaction_strength, T stretching_exponent,
+                  T epsilon = 1.0)
+      : _model(model), _interaction_strength(interaction_strength),
+        _exponent(stretching_exponent), _epsilon(epsilon), _sin(0.0),
+        _cos(0.0), _sinh(0.0) {
+    if (interaction_strength <= 0) {
+      _warning = "interaction strength must be positive";
+    }
+    switch (model) {
+    case Model::j_3d:
+    case Model::j_2d:
+      if (stretching_exponent > 2 or stretching_exponent < 1) {
+        _warning = "stretching exponent outside of bounds : [1, 2]";
+      }
+      break;
+    case Model::j_cc:
+    case Model::j_dc:
+    case Model::j_fang:
+    case Model::j_fk:
+      if (stretching_exponent > 1 or stretching_exponent <= 0) {
+        _warning = "stretching exponent outside of bounds : (0, 1]";
+      }
+      break;
+    case Model::j_hn:
+      if (stretching_exponent > 1 or stretching_exponent <= 0 or
+          epsilon > 1.0 / stretching_exponent or epsilon <= 0) {
+        _warning = "stretching exponents outside of bounds : delta -> (0, 1], "
+                   "epsilon -> (0, 1/delta]";
+      }
+      break;
+    case Model::j_lg:
+    case Model::j_ll:
+    case Model::j_eb:
+      if (not(stretching_exponent > 0)) {
+        _warning = "distribution width must be positive";
+      }
+      break;
+    case Model::j_bm:
+      if (not(stretching_exponent > 0) or not(epsilon > 0)) {
+        _warning = "distribution exponents must be positive : epsilon -> "
+                   "(0, inf), eta -> (0, inf)";
+      }
+      break;
+    }
+    if (model == Model::j_lg and valid()) {
+      _distribution = DistributedSpectralDensity<T>::log_gaussian(
+          stretching_exponent);
+    }
+    if (model == Model::j_bm and valid()) {
+      _distribution = DistributedSpectralDensity<T>::bryn_mawr(
+          stretching_exponent, epsilon);
+    }
+    const T angle = stretching_exponent * boost::math::constants::pi<T>() / 2.0;
+    _sin = std::sin(angle);
+    _cos = std::cos(angle);
+    _sinh = std::sinh(stretching_exponent / 2.0);
+  };
+
+  /// Return true if the parameters are within their bounds.
+  bool valid() const { return _warning.empty(); };
+
+  /// Return the reason the parameters are invalid (empty if they are valid).
+  const std::string &warning() const { return _warning; };
+
+  /// Return the spectral density for a single correlation time & frequency.
+  T operator()(T correlation_time, T nmr_frequency) const {
+    T j;
+    evaluate(&correlation_time, 1, nmr_frequency, &j);
+    return j;
+  };
+
+  /// Return the spectral density for n correlation times at a single
+  /// frequency.
+  void operator()(const T *correlation_time, std::size_t n, T nmr_frequency,
+                  T *j) const {
+    evaluate(correlation_time, n, nmr_frequency, j);
+  };
+
+  /// Return the spectral density for each (correlation time, frequency)
+  /// pair.
+  std::vector<T> operator()(const std::vector<T> &correlation_time,
+                            const std::vector<T> &nmr_frequency) const {
+    if (correlation_time.size() != nmr_frequency.size()) {
+      throw std::invalid_argument("triumf::nmr::SpectralDensity: input sizes");
+    }
+    std::vector<T> j(correlation_time.size());
+    for (std::size_t i = 0; i < j.size(); ++i) {
+      evaluate(&correlation_time[i], 1, nmr_frequency[i], &j[i]);
+    }
+    return j;
+  };
+
+  /// \brief Return the spectral density on a (temperature, frequency) grid,
+  /// with Arrhenius correlation times (see tau_c).
+  /// \details The correlation times are computed once per temperature. The
+  /// result is stored frequency by frequency, i.e., element
+  /// [k * temperature.size() + i] corresponds to (temperature[i],
+  /// nmr_frequency[k]).
+  std::vector<T> operator()(const std::vector<T> &temperature,
+                            const std::vector<T> &nmr_frequency, T prefactor,
+                            T activation_energy) const {
+    const std::vector<T> correlation_time =
+        tau_c<T>(temperature, prefactor, activation_energy);
+    std::vector<T> j(temperature.size() * nmr_frequency.size());
+    for (std::size_t k = 0; k < nmr_frequency.size(); ++k) {
+      evaluate(correlation_time.data(), correlation_time.size(),
+               nmr_frequency[k], j.data() + k * temperature.size());
+    }
+    return j;
+  };
+
+private:
+  /// spectral density for n correlation times at a single frequency
+  void evaluate(const T *tau, std::size_t n, T omega, T *j) const {
+    // invalid parameters or frequency (for any correlation time)
+    if (not valid() or omega < 0) {
+      std::fill(j, j + n, T(0.0));
+      return;
+    }
+    const T A = _interaction_strength;
+    const T beta = _exponent;
+    // common prefactor for the "2 / ω" models
+    const T a = A * 2.0 / omega;
+    switch (_model) {
+    case Model::j_3d:
+      for (std::size_t i = 0; i < n; ++i) {
+        j[i] = A * 2.0 * tau[i] / (1.0 + std::pow(omega * tau[i], beta));
+      }
+      break;
+    case Model::j_2d:
+      for (std::size_t i = 0; i < n; ++i) {
+        j[i] = A * tau[i] * std::log1p(std::pow(omega * tau[i], -beta));
+      }
+      break;
+    case Model::j_cc:
+      for (std::size_t i = 0; i < n; ++i) {
+        const T x_beta = std::pow(omega * tau[i], beta);
+        j[i] = a * _sin * x_beta /
+               (1.0 + x_beta * x_beta + 2.0 * _cos * x_beta);
+      }
+      break;
+    case Model::j_dc:
+      for (std::size_t i = 0; i < n; ++i) {
+        const T x = omega * tau[i];
+        j[i] = a * std::sin(beta * std::atan(x)) /
+               std::pow(1.0 + x * x, beta / 2.0);
+      }
+      break;
+    case Model::j_fang:
+      for (std::size_t i = 0; i < n; ++i) {
+        const T x = omega * tau[i];
+        j[i] = a * std::pow(x, beta) * std::sin(beta * std::atan(1.0 / x)) /
+               std::pow(1.0 + x * x, beta / 2.0);
+      }
+      break;
+    case Model::j_fk:
+      for (std::size_t i = 0; i < n; ++i) {
+        const T x_beta = std::pow(omega * tau[i], beta);
+        j[i] = a * beta * x_beta / (1.0 + x_beta * x_beta);
+      }
+      break;
+    case Model::j_hn:
+      for (std::size_t i = 0; i < n; ++i) {
+        const T x_delta = std::pow(omega * tau[i], beta);
+        j[i] = a *
+               std::sin(_epsilon *
+                        std::atan(x_delta * _sin / (1.0 + x_delta * _cos))) *
+               std::pow(1.0 + 2.0 * x_delta * _cos + x_delta * x_delta,
+                        -_epsilon / 2.0);
+      }
+      break;
+    case Model::j_lg:
+    case Model::j_bm:
+      _distribution(tau, n, omega, j);
+      for (std::size_t i = 0; i < n; ++i) {
+        j[i] *= A;
+      }
+      break;
+    case Model::j_ll:
+      // (2 / π) Re[β(1/2 + (σ - i ln(ω τ)) / π)]
+      for (std::size_t i = 0; i < n; ++i) {
+        const T L = std::log(omega * tau[i]);
+        j[i] = std::isfinite(L)
+                   ? (A / omega) * boost::math::constants::two_div_pi<T>() *
+                         detail::real_nielsen_beta<T>(
+                             0.5 + beta / boost::math::constants::pi<T>(),
+                             -L / boost::math::constants::pi<T>())
+                   : T(0.0);
+      }
+      break;
+    case Model::j_eb:
+      // (2 / w) atan(sinh(w / 2) sech(ln(ω τ)))
+      for (std::size_t i = 0; i < n; ++i) {
+        const T x = omega * tau[i];
+        j[i] = (A / omega) * (2.0 / beta) *
+               std::atan(_sinh * 2.0 * x / (1.0 + x * x));
+      }
+      break;
+    }
+    // negative correlation times
+    for (std::size_t i = 0; i < n; ++i) {
+      j[i] = tau[i] < 0 ? T(0.0) : j[i];
+    }
+  };
+
+  /// spectral density function
+  Model _model;
+  /// interaction strength
+  T _interaction_strength;
+  /// stretching exponent(s)
+  T _exponent;
+  T _epsilon;
+  /// sin(β π / 2) & cos(β π / 2)
+  T _sin;
+  T _cos;
+  /// sinh(w / 2) (energy box)
+  T _sinh;
+  /// nodes & weights (log-Gaussian & Bryn-Mawr)
+  DistributedSpectralDensity<T> _distribution;
+  /// reason the parameters are invalid (if any)
+  std::string _warning;
+};
+
+namespace detail {
+
+/// \brief Return the nodes of a distribution of ln(τ) with the given
+/// parameters, reusing those of the (calling thread's) previous call if they
+/// match (e.g., for many correlation times at the same width).
+template <typename T, typename Factory>
+const DistributedSpectralDensity<T> &cached_distribution(T a, T b,
+                                                         Factory factory) {
+  thread_local T cached_a = std::numeric_limits<T>::quiet_NaN();
+  thread_local T cached_b = std::numeric_limits<T>::quiet_NaN();
+  thread_local DistributedSpectralDensity<T> nodes;
+  if (not(a == cached_a and b == cached_b)) {
+    nodes = factory();
+    cached_a = a;
+    cached_b = b;
+  }
+  return nodes;
+}
+
+} // namespace detail
+
+// Wagner (i.e., log-Gaussian) - Gaussian distribution of ln(τ / τ_c), with
+// standard deviation width (j_lg -> j_3d w/ stretching_exponent = 2 as
+// width -> 0)
+// Note: the nodes are reused while the width is unchanged; for invalid
+// parameters 0 is returned without a warning (see SpectralDensity::warning)
+template <typename T = double>
+T j_lg(T correlation_time, T nmr_frequency, T interaction_strength, T width) {
+  if (correlation_time < 0 or nmr_frequency < 0 or interaction_strength <= 0 or
+      not(width > 0)) {
+    return 0.0;
+  }
+  const DistributedSpectralDensity<T> &nodes = detail::cached_distribution(
+      width, T(0.0),
+      [&]() { return DistributedSpectralDensity<T>::log_gaussian(width); });
+  return nodes(correlation_time, nmr_frequency) * interaction_strength;
+}
+
+// log-Lorentzian - Lorentzian distribution of ln(τ / τ_c), with half width at
+// half maximum width (j_ll -> j_3d w/ stretching_exponent = 2 as width -> 0)
+// Note: for invalid parameters 0 is returned without a warning
+template <typename T = double>
+T j_ll(T correlation_time, T nmr_frequency, T interaction_strength, T width) {
+  if (correlation_time < 0 or nmr_frequency < 0 or interaction_strength <= 0 or
+      not(width > 0)) {
+    return 0.0;
+  }
+  // (2 / π) Re[β(1/2 + (σ - i ln(ω τ)) / π)]
+  const T L = std::log(nmr_frequency * correlation_time);
+  return std::isfinite(L)
+             ? (interaction_strength / nmr_frequency) *
+                   boost::math::constants::two_div_pi<T>() *
+                   detail::real_nielsen_beta<T>(
+                       0.5 + width / boost::math::constants::pi<T>(),
+                       -L / boost::math::constants::pi<T>())
+             : T(0.0);
+}
+
+// Frolich (i.e., energy box) - uniform distribution of activation energies,
+// i.e., of ln(τ / τ_c) over a box of (full) width = ΔE / (k_B T)
+// (j_eb -> j_3d w/ stretching_exponent = 2 as width -> 0)
+// Note: for invalid parameters 0 is returned without a warning
+template <typename T = double>
+T j_eb(T correlation_time, T nmr_frequency, T interaction_strength, T width) {
+  if (correlation_time < 0 or nmr_frequency < 0 or interaction_strength <= 0 or
+      not(width > 0)) {
+    return 0.0;
+  }
+  // (2 / w) atan(sinh(w / 2) sech(ln(ω τ)))
+  const T x = nmr_frequency * correlation_time;
+  const T sinh_half_width = std::sinh(width / 2.0);
+  return (interaction_strength / nmr_frequency) * (2.0 / width) *
+         std::atan(sinh_half_width * 2.0 * x / (1.0 + x * x));
+}
+
+// Bryn-Mawr - generalized gamma distribution of τ / τ_c, with epsilon the
+// slope of its (power law) short-τ tail and eta the sharpness of its
+// (stretched exponential) long-τ cutoff (see
+// DistributedSpectralDensity::bryn_mawr)
+// Note: the nodes are reused while epsilon & eta are unchanged; for invalid
+// parameters 0 is returned without a warning (see SpectralDensity::warning)
+template <typename T = double>
+T j_bm(T correlation_time, T nmr_frequency, T interaction_strength = 1,
+       T epsilon = 1, T eta = 1) {
+  if (correlation_time < 0 or nmr_frequency < 0 or interaction_strength <= 0 or
+      not(epsilon > 0) or not(eta > 0)) {
+    return 0.0;
+  }
+  const DistributedSpectralDensity<T> &nodes =
+      detail::cached_distribution(epsilon, eta, [&]() {
+        return DistributedSpectralDensity<T>::bryn_mawr(epsilon, eta);
+      });
+  return nodes(correlation_time, nmr_frequency) * interaction_strength;
+}
+
 } // namespace nmr
 
 } // namespace triumf
@@ -0,0 +1,34 @@
+#ifndef TRIUMF_PCH_HPP
+#define TRIUMF_PCH_HPP
+
+// The common include set, to be precompiled (see `make pch`) and included
+// first, with -include triumf/pch.hpp (rather than #include), using the same
+// compiler flags as the precompiled header. The library's templates are
+// declared extern (see triumf/extern_templates.hpp), so programs must be
+// linked with libtriumfpp.
+
+// C++ standard library headers
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+// Boost headers
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/quadrature/exp_sinh.hpp>
+#include <boost/math/quadrature/gauss_kronrod.hpp>
+#include <boost/math/quadrature/ooura_fourier_integrals.hpp>
+#include <boost/math/quadrature/tanh_sinh.hpp>
+#include <boost/math/tools/roots.hpp>
+
+// triumf++ headers
+#include <triumf/constants/codata_2018.hpp>
+#include <triumf/extern_templates.hpp>
+#include <triumf/numpy.hpp>
+
+#endif // TRIUMF_PCH_HPP
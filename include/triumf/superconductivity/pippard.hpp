@@ -1,12 +1,17 @@
 #ifndef TRIUMF_SUPERCONDUCTIVITY_PIPPARD_HPP
 #define TRIUMF_SUPERCONDUCTIVITY_PIPPARD_HPP
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
+#include <vector>
 
 // #include <boost/multiprecision/cpp_dec_float.hpp>
 
 #include <triumf/constants/codata_2018.hpp>
+#include <triumf/instrumentation.hpp>
 #include <triumf/superconductivity/bcs.hpp>
+#include <triumf/superconductivity/field_profile.hpp>
 #include <triumf/superconductivity/phenomenology.hpp>
 
 // TRIUMF: Canada's particle accelerator centre
@@ -21,19 +26,25 @@ namespace pippard {
 ///
 template <typename T = double>
 T J_0(T temperature, T critical_temperature, T gap_meV, T exponent) {
+  using std::pow;
+  using std::tanh;
   // Boltzmann constant (meV / K)
-  constexpr T k_B_meV_per_K =
+  const T k_B_meV_per_K =
       1e3 *
       triumf::constants::codata_2018::Boltzmann_constant_in_eV_K<T>::value();
   //
   // T reduced_temperature = temperature / critical_temperature;
   //
-  return std::pow(phenomenology::reduced_penetration_depth<T>(
-                      temperature, critical_temperature, exponent),
-                  2) *
+  // the zero temperature limit (i.e., without evaluating tanh(inf))
+  if (temperature == 0.0) {
+    return 1.0;
+  }
+  return pow(phenomenology::reduced_penetration_depth<T>(
+                 temperature, critical_temperature, exponent),
+             2) *
          bcs::reduced_gap<T>(temperature, critical_temperature) *
-         std::tanh(bcs::gap<T>(temperature, critical_temperature, gap_meV) /
-                   (2.0 * k_B_meV_per_K * temperature));
+         tanh(bcs::gap<T>(temperature, critical_temperature, gap_meV) /
+              (2.0 * k_B_meV_per_K * temperature));
 }
 
 /// temperature dependence of the Pippard coherence length,
@@ -41,12 +52,13 @@ T J_0(T temperature, T critical_temperature, T gap_meV, T exponent) {
 template <typename T = double>
 T coherence_length(T temperature, T critical_temperature, T gap_meV, T exponent,
                    T xi_0, T mean_free_path) {
+  using std::abs;
   T fraction_1 =
       J_0<T>(temperature, critical_temperature, gap_meV, exponent) / xi_0;
   T fraction_2 = 1.0 / mean_free_path;
   T fraction = fraction_1 + fraction_2;
   // handle a some edge cases for very big/small args
-  if (std::isinf(fraction)) {
+  if (abs(fraction) == std::numeric_limits<T>::infinity()) {
     return 0.0;
   } else if (fraction == 0.0) {
     return std::numeric_limits<T>::infinity();
@@ -73,11 +85,19 @@ template <typename T = double> T g(T x) {
       (3.0 / 2.0) * ((1.0 + x * x) * std::atan(x) - x) / (x * x * x);
   return value;
   */
-  // return correct result when x ~ 0.
-  if (x < 1.0e-4) {
-    return 1.0;
+  using std::atan;
+  // for small x, use the Maclaurin series to avoid the cancellation in the
+  // closed form (which is severe in single precision), i.e.,
+  // g(x) = sum_k 3 (-1)^k x^(2 k) / ((2 k + 1) (2 k + 3))
+  if (x < 0.1) {
+    const T x2 = x * x;
+    T sum = 0.0;
+    for (int k = 10; k >= 0; --k) {
+      sum = sum * x2 + (k % 2 == 0 ? 3.0 : -3.0) / ((2 * k + 1) * (2 * k + 3));
+    }
+    return sum;
   } else {
-    return (3.0 / 2.0) * ((1.0 + x * x) * std::atan(x) - x) / (x * x * x);
+    return (3.0 / 2.0) * ((1.0 + x * x) * atan(x) - x) / (x * x * x);
   }
 }
 
@@ -85,11 +105,13 @@ template <typename T = double> T g(T x) {
 template <typename T = double>
 T kernel(T q, T temperature, T critical_temperature, T gap_meV, T xi_0,
          T mean_free_path, T lambda_0, T exponent) {
+  using std::pow;
   T x = q * coherence_length<T>(temperature, critical_temperature, gap_meV,
                                 exponent, xi_0, mean_free_path);
-  return std::pow(phenomenology::penetration_depth<T>(
-                      temperature, critical_temperature, exponent, lambda_0),
-                  -2) *
+  return pow(phenomenology::penetration_depth<T>(temperature,
+                                                 critical_temperature,
+                                                 exponent, lambda_0),
+             -2) *
          reduced_coherence_length<T>(temperature, critical_temperature, gap_meV,
                                      exponent, xi_0, mean_free_path) *
          g<T>(x);
@@ -125,16 +147,70 @@ T reduced_field_penetration(T z, T temperature, T critical_temperature,
     // static T tolerance = std::sqrt(std::numeric_limits<T>::epsilon());
     static T tolerance = std::cbrt(std::numeric_limits<T>::epsilon());
     std::size_t levels = sizeof(T);
-    static boost::math::quadrature::ooura_fourier_sin<T> pippard_integrator =
+    // (one integrator per thread, so concurrent calls are safe)
+    static thread_local boost::math::quadrature::ooura_fourier_sin<T>
+        pippard_integrator =
         boost::math::quadrature::ooura_fourier_sin<T>(tolerance, levels);
     // evaluate the integral, which returns a pair
     // (first = integral, second = relative error)
-    std::pair<T, T> result = pippard_integrator.integrate(pippard_integrand, z);
+    triumf::instrumentation::Probe<T> probe(
+        "triumf::superconductivity::pippard::reduced_field_penetration");
+    std::pair<T, T> result =
+        pippard_integrator.integrate(probe.counted(pippard_integrand), z);
+    probe.set_error(result.second);
     // return the integral multiplied by the prefactors to get B vs. z
     return boost::math::constants::two_div_pi<T>() * result.first;
   }
 }
 
+/// (reduced) Pippard magnetic field penetration profile at many depths at once,
+/// using a single (shared) evaluation of the kernel (see FieldProfile)
+template <typename T = double>
+std::vector<T> reduced_field_penetration(const std::vector<T> &z, T temperature,
+                                         T critical_temperature, T gap_meV,
+                                         T xi_0, T mean_free_path, T lambda_0,
+                                         T exponent) {
+  std::vector<T> b(z.size(), 1.0);
+  if (z.empty()) {
+    return b;
+  }
+  // the (q-independent) kernel prefactor and coherence length
+  const T K_0 = kernel<T>(0.0, temperature, critical_temperature, gap_meV,
+                          xi_0, mean_free_path, lambda_0, exponent);
+  const T xi = coherence_length<T>(temperature, critical_temperature, gap_meV,
+                                   exponent, xi_0, mean_free_path);
+  auto pippard_kernel = [K_0, xi](T q) { return K_0 * g<T>(q * xi); };
+  // the kernel varies on the scale of the coherence length
+  T length_scale = xi;
+  if (not(length_scale > 0.0) or std::isinf(length_scale)) {
+    length_scale = lambda_0;
+  }
+  const T z_max = std::max(*std::max_element(z.begin(), z.end()), T(1.0));
+  const FieldProfile<T> profile(pippard_kernel, z_max, length_scale);
+  profile(z, b);
+  return b;
+}
+
+/// Accuracy of the (reduced) Pippard magnetic field penetration profile
+/// computed at many depths at once, compared to the point-wise Fourier
+/// integrals.
+template <typename T = double>
+FieldProfileAccuracy<T> reduced_field_penetration_accuracy(
+    const std::vector<T> &z, T temperature, T critical_temperature, T gap_meV,
+    T xi_0, T mean_free_path, T lambda_0, T exponent) {
+  return field_profile_accuracy<T>(
+      z,
+      reduced_field_penetration<T>(z, temperature, critical_temperature,
+                                   gap_meV, xi_0, mean_free_path, lambda_0,
+                                   exponent),
+      [&](T z_i) {
+        return reduced_field_penetration<T>(z_i, temperature,
+                                            critical_temperature, gap_meV,
+                                            xi_0, mean_free_path, lambda_0,
+                                            exponent);
+      });
+}
+
 /// magnetic field penetration proifile
 template <typename T = double>
 T field_penetration(T z, T temperature, T critical_temperature, T gap_meV,
@@ -0,0 +1,6 @@
+// Explicit instantiation definitions of the templates declared extern in
+// triumf/extern_templates.hpp, i.e., the contents of libtriumfpp (see
+// `make lib`).
+
+#define TRIUMF_EXTERN_TEMPLATE template
+#include <triumf/extern_templates.hpp>
@@ -0,0 +1,143 @@
+#define BOOST_TEST_MODULE BNMR_DECAY_CHAIN
+#include <boost/test/included/unit_test.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include <triumf/bnmr/decay_chain.hpp>
+#include <triumf/bnmr/nuclei.hpp>
+#include <triumf/bnmr/slr/magnesium_31/decay_corrections.hpp>
+#include <triumf/numpy.hpp>
+
+typedef std::tuple<float, double, long double> test_types;
+
+//
+BOOST_AUTO_TEST_CASE_TEMPLATE(decay_chain_magnesium_31, T, test_types) {
+  namespace magnesium_31 = triumf::bnmr::slr::magnesium_31;
+  const T tolerance =
+      std::max(T(1e-9), 1000 * std::numeric_limits<T>::epsilon());
+  const triumf::bnmr::DecayChain<T> chain = magnesium_31::decay_chain<T>();
+  BOOST_TEST(chain.size() == 6);
+  BOOST_TEST(chain.index("30Al") == 4);
+  // closed forms
+  typedef double (*function)(double, double, double);
+  const std::size_t n_radioactive = 4;
+  const std::size_t radioactive[] = {0, 1, 2, 4};
+  const function number[] = {magnesium_31::n_31Mg, magnesium_31::n_31Al,
+                             magnesium_31::n_31Si, magnesium_31::n_30Al};
+  const function activity[] = {magnesium_31::a_31Mg, magnesium_31::a_31Al,
+                               magnesium_31::a_31Si, magnesium_31::a_30Al};
+  const function fraction[] = {magnesium_31::fa_31Mg, magnesium_31::fa_31Al,
+                               magnesium_31::fa_31Si, magnesium_31::fa_30Al};
+  //
+  const double beam_rate = 1e6;
+  for (const T pulse_length : {T(0.5), T(4.0)}) {
+    const auto pulse = chain.pulse(pulse_length, beam_rate);
+    const double p = pulse_length;
+    for (const T t : triumf::numpy::linspace<T>(0.5, 16.0, 156)) {
+      for (std::size_t j = 0; j < n_radioactive; ++j) {
+        const std::size_t i = radioactive[j];
+        BOOST_TEST(pulse.number(i, t) == T(number[j](t, p, beam_rate)),
+                   boost::test_tools::tolerance(tolerance));
+        BOOST_TEST(pulse.activity(i, t) == T(activity[j](t, p, beam_rate)),
+                   boost::test_tools::tolerance(tolerance));
+        BOOST_TEST(pulse.detected_fraction(i, t) ==
+                       T(fraction[j](t, p, beam_rate)),
+                   boost::test_tools::tolerance(tolerance));
+      }
+      BOOST_TEST(pulse.number(5, t) ==
+                     T(magnesium_31::n_30Si(t, p, beam_rate)),
+                 boost::test_tools::tolerance(tolerance));
+      // (phosphorus-31's closed form suffers from cancellation at early
+      // times, so it is compared relative to the number of implanted atoms)
+      BOOST_TEST(std::abs(pulse.number(3, t) -
+                          T(magnesium_31::n_31P(t, p, beam_rate))) <=
+                 tolerance * beam_rate * std::min(t, pulse_length));
+      // stable nuclides are not detected
+      BOOST_TEST(pulse.activity(3, t) == 0.0);
+      BOOST_TEST(pulse.activity(5, t) == 0.0);
+      // all of the implanted atoms remain in the chain
+      BOOST_TEST(pulse.total_number(t) ==
+                     T(beam_rate * std::min(t, pulse_length)),
+                 boost::test_tools::tolerance(tolerance));
+    }
+    // the limit time -> 0+
+    BOOST_TEST(pulse.detected_fraction(0, 0.0) == 1.0);
+    BOOST_TEST(pulse.detected_fraction(1, 0.0) == 0.0);
+    BOOST_TEST(pulse.number(0, -1.0) == 0.0);
+  }
+  // the decay corrections are the detected fraction of magnesium-31
+  const auto pulse = chain.pulse(1.0, 1.0);
+  const magnesium_31::DecayCorrections<T> corrections(1.0);
+  const std::vector<T> time = triumf::numpy::linspace<T>(-1.0, 16.0, 171);
+  std::vector<T> result;
+  pulse.detected_fraction(0, time, result);
+  BOOST_TEST(result.size() == time.size());
+  for (std::size_t i = 0; i < time.size(); ++i) {
+    BOOST_TEST(result[i] == corrections(time[i]),
+               boost::test_tools::tolerance(tolerance));
+  }
+}
+
+//
+BOOST_AUTO_TEST_CASE_TEMPLATE(decay_chain_probes, T, test_types) {
+  namespace nuclei = triumf::bnmr::nuclei;
+  namespace decay_chains = triumf::bnmr::decay_chains;
+  const T tolerance =
+      std::max(T(1e-12), 100 * std::numeric_limits<T>::epsilon());
+  const T beam_rate = 1e6;
+  // a single radioactive probe, with stable daughters
+  auto check = [&](const triumf::bnmr::DecayChain<T> &chain, T lifetime) {
+    for (const T pulse_length : {T(0.01), T(1.0), T(4.0)}) {
+      const auto pulse = chain.pulse(pulse_length, beam_rate);
+      const T end =
+          beam_rate * lifetime * -std::expm1(-pulse_length / lifetime);
+      for (const T t : triumf::numpy::linspace<T>(0.01, 16.0, 160)) {
+        const T n = t <= pulse_length
+                        ? beam_rate * lifetime * -std::expm1(-t / lifetime)
+                        : end * std::exp(-(t - pulse_length) / lifetime);
+        BOOST_TEST(pulse.number(0, t) == n,
+                   boost::test_tools::tolerance(tolerance));
+        BOOST_TEST(pulse.activity(0, t) == n / lifetime,
+                   boost::test_tools::tolerance(tolerance));
+        // (until the activity underflows)
+        if (n > 0.0) {
+          BOOST_TEST(pulse.detected_fraction(0, t) == T(1.0),
+                     boost::test_tools::tolerance(tolerance));
+        }
+        BOOST_TEST(pulse.total_number(t) ==
+                       beam_rate * std::min(t, pulse_length),
+                   boost::test_tools::tolerance(tolerance));
+      }
+    }
+  };
+  check(decay_chains::lithium_8<T>(), nuclei::lithium_8<T>::lifetime());
+  check(decay_chains::beryllium_11<T>(), nuclei::beryllium_11<T>::lifetime());
+  check(decay_chains::boron_12<T>(), nuclei::boron_12<T>::lifetime());
+}
+
+//
+BOOST_AUTO_TEST_CASE_TEMPLATE(decay_chain_invalid, T, test_types) {
+  triumf::bnmr::DecayChain<T> chain;
+  chain.add_nuclide("A", 1.0);
+  chain.add_nuclide("B", 1.0);
+  chain.add_nuclide("C", std::numeric_limits<T>::infinity(), 0.0);
+  // parents must precede their daughters
+  BOOST_CHECK_THROW(chain.add_branch(1, 0, 1.0), std::invalid_argument);
+  BOOST_CHECK_THROW(chain.add_branch("A", "D", 1.0), std::invalid_argument);
+  // stable nuclides do not decay
+  chain.add_branch("A", "B", 1.0);
+  chain.add_nuclide("D", std::numeric_limits<T>::infinity(), 0.0);
+  BOOST_CHECK_THROW(chain.add_branch(2, 3, 1.0), std::domain_error);
+  BOOST_CHECK_THROW(chain.add_branch(1, 2, 1.5), std::domain_error);
+  BOOST_CHECK_THROW(chain.add_nuclide("E", -1.0), std::domain_error);
+  // degenerate decay constants
+  BOOST_CHECK_THROW(chain.pulse(1.0), std::domain_error);
+  BOOST_CHECK_THROW(triumf::bnmr::decay_chains::lithium_8<T>().pulse(0.0),
+                    std::domain_error);
+}
@@ -0,0 +1,259 @@
+#define BOOST_TEST_MODULE BNMR_RESONANCE
+#include <boost/test/included/unit_test.hpp>
+
+#include <algorithm>
+#include <array>
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/quadrature/sinh_sinh.hpp>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <triumf/bnmr/nuclei.hpp>
+#include <triumf/bnmr/resonance/lineshape.hpp>
+#include <triumf/bnmr/resonance/spectrum.hpp>
+#include <vector>
+
+typedef std::tuple<float, double, long double> test_types;
+
+namespace resonance = triumf::bnmr::resonance;
+
+//
+BOOST_AUTO_TEST_CASE_TEMPLATE(lineshape_area, T, test_types) {
+  // every lineshape is normalized (i.e., has unit area)
+  boost::math::quadrature::sinh_sinh<T> integrator;
+  const T tolerance =
+      std::max(T(1e-6), 100 * std::numeric_limits<T>::epsilon());
+  const T position = 0.5;
+  auto area = [&](auto f) { return integrator.integrate(f); };
+  for (const T width : {T(0.5), T(1.0), T(3.0)}) {
+    BOOST_TEST(area([&](T x) {
+                 return resonance::lorentzian<T>(x, position, width);
+               }) == T(1.0),
+               boost::test_tools::tolerance(tolerance));
+    BOOST_TEST(area([&](T x) {
+                 return resonance::gaussian<T>(x, position, width);
+               }) == T(1.0),
+               boost::test_tools::tolerance(tolerance));
+    BOOST_TEST(area([&](T x) {
+                 return resonance::voigt<T>(x, position, width, T(0.7));
+               }) == T(1.0),
+               boost::test_tools::tolerance(tolerance));
+    BOOST_TEST(area([&](T x) {
+                 return resonance::pseudo_voigt<T>(x, position, width, T(0.3));
+               }) == T(1.0),
+               boost::test_tools::tolerance(tolerance));
+  }
+}
+
+//
+BOOST_AUTO_TEST_CASE_TEMPLATE(lineshape_width, T, test_types) {
+  const T tolerance = 10 * std::numeric_limits<T>::epsilon();
+  const T position = -2.0;
+  const T width = 1.5;
+  // half maximum at the half width
+  BOOST_TEST(resonance::lorentzian<T>(position + width, position, width) ==
+                 T(0.5) * resonance::lorentzian<T>(position, position, width),
+             boost::test_tools::tolerance(tolerance));
+  const T sigma_hwhm = boost::math::constants::root_ln_four<T>();
+  BOOST_TEST(resonance::gaussian<T>(position - width * sigma_hwhm, position,
+                                    width) ==
+                 T(0.5) * resonance::gaussian<T>(position, position, width),
+             boost::test_tools::tolerance(tolerance));
+  for (const T eta : {T(0.0), T(0.4), T(1.0)}) {
+    BOOST_TEST(resonance::pseudo_voigt<T>(position + T(0.5) * width, position,
+                                          width, eta) ==
+                   T(0.5) * resonance::pseudo_voigt<T>(position, position,
+                                                       width, eta),
+               boost::test_tools::tolerance(tolerance));
+  }
+  // the Voigt profile's limits
+  for (const T x : {T(-3.0), T(-1.0), T(0.0), T(0.5), T(2.0)}) {
+    BOOST_TEST(resonance::voigt<T>(x, position, width, T(1e-9)) ==
+                   resonance::gaussian<T>(x, position, width),
+               boost::test_tools::tolerance(T(1e-6)));
+    BOOST_TEST(resonance::voigt<T>(x, position, T(1e-6), width) ==
+                   resonance::lorentzian<T>(x, position, width),
+               boost::test_tools::tolerance(T(1e-6)));
+  }
+}
+
+//
+BOOST_AUTO_TEST_CASE_TEMPLATE(lineshape_batch, T, test_types) {
+  const T step = std::cbrt(std::numeric_limits<T>::epsilon());
+  const T tolerance = std::max(T(1e-6), 100 * step * step);
+  std::vector<T> detuning;
+  for (int i = -20; i <= 20; ++i) {
+    detuning.push_back(T(0.25) * i);
+  }
+  const std::size_t n = detuning.size();
+  // compare the values against the scalar lineshape (f), and the derivatives
+  // against its central differences
+  auto check = [&](auto lineshape, const auto &par, auto f) {
+    using Lineshape = decltype(lineshape);
+    constexpr unsigned int n_par = Lineshape::n_parameters;
+    BOOST_TEST(n_par == std::size(par));
+    std::vector<T> value(n), derivative((n_par + 1) * n), no_derivative(n);
+    Lineshape::evaluate(detuning.data(), n, par.data(), value.data(),
+                        derivative.data());
+    Lineshape::evaluate(detuning.data(), n, par.data(), no_derivative.data());
+    for (std::size_t i = 0; i < n; ++i) {
+      BOOST_TEST(no_derivative[i] == value[i]);
+      // (relative to the peak, as the tails are exponentially small)
+      BOOST_TEST(std::abs(value[i] - f(detuning[i], par)) <=
+                 100 * std::numeric_limits<T>::epsilon() * f(T(0.0), par));
+      // with respect to the detuning
+      const T h = step * std::max(T(1.0), std::abs(detuning[i]));
+      const T slope =
+          (f(detuning[i] + h, par) - f(detuning[i] - h, par)) / (2 * h);
+      BOOST_TEST(std::abs(derivative[i] - slope) <=
+                 tolerance * std::max(T(1.0), std::abs(derivative[i])));
+      // with respect to the shape parameters
+      for (unsigned int k = 0; k < n_par; ++k) {
+        std::array<T, n_par> p = par;
+        const T h = step * std::max(T(1.0), std::abs(par[k]));
+        p[k] = par[k] + h;
+        const T plus = f(detuning[i], p);
+        p[k] = par[k] - h;
+        const T minus = f(detuning[i], p);
+        const T d = derivative[(k + 1) * n + i];
+        BOOST_TEST(std::abs(d - (plus - minus) / (2 * h)) <=
+                   tolerance * std::max(T(1.0), std::abs(d)));
+      }
+    }
+  };
+  //
+  for (const T width : {T(0.3), T(1.0), T(2.5)}) {
+    check(resonance::Lorentzian<T>(), std::array<T, 1>{width},
+          [](T x, const std::array<T, 1> &p) {
+            return resonance::lorentzian<T>(x, T(0.0), p[0]);
+          });
+    check(resonance::Gaussian<T>(), std::array<T, 1>{width},
+          [](T x, const std::array<T, 1> &p) {
+            return resonance::gaussian<T>(x, T(0.0), p[0]);
+          });
+    for (const T other : {T(0.05), T(0.8), T(4.0)}) {
+      check(resonance::Voigt<T>(), std::array<T, 2>{width, other},
+            [](T x, const std::array<T, 2> &p) {
+              return resonance::voigt<T>(x, T(0.0), p[0], p[1]);
+            });
+    }
+    for (const T eta : {T(0.0), T(0.25), T(1.0)}) {
+      check(resonance::PseudoVoigt<T>(), std::array<T, 2>{width, eta},
+            [](T x, const std::array<T, 2> &p) {
+              return resonance::pseudo_voigt<T>(x, T(0.0), p[0], p[1]);
+            });
+    }
+  }
+}
+
+//
+BOOST_AUTO_TEST_CASE_TEMPLATE(quadrupole_splitting, T, test_types) {
+  namespace nuclei = triumf::bnmr::nuclei;
+  // lithium-8 (I = 2) in an electric field gradient of 10^21 V m^-2
+  BOOST_TEST(resonance::quadrupole_frequency<nuclei::lithium_8>(T(1e21)) ==
+                 T(197066.123),
+             boost::test_tools::tolerance(T(1e-6)));
+  // boron-12 (I = 1)
+  BOOST_TEST(resonance::quadrupole_frequency<nuclei::boron_12>(T(1e21)) ==
+                 T(3.0 / 2.0 * 2.417989242084918e14 * 0.0132e-7),
+             boost::test_tools::tolerance(T(1e-6)));
+  //
+  typedef resonance::QuadrupoleSplitResonance<resonance::Voigt,
+                                              nuclei::lithium_8, T>
+      Li8;
+  BOOST_TEST(Li8::n_lines == 4);
+  BOOST_TEST(Li8::n_parameters == 9);
+  const Li8 li8(0.1, 10.0, 2.0, {0.5, 0.2}, {1.0, 2.0, 3.0, 4.0});
+  const T positions[] = {7.0, 9.0, 11.0, 13.0};
+  for (unsigned int l = 0; l < Li8::n_lines; ++l) {
+    BOOST_TEST(li8.position(l) == positions[l]);
+  }
+  typedef resonance::QuadrupoleSplitResonance<resonance::Lorentzian,
+                                              nuclei::boron_12, T>
+      B12;
+  BOOST_TEST(B12::n_lines == 2);
+  BOOST_TEST(B12::n_parameters == 6);
+  const B12 b12(0.0, 10.0, 2.0, {0.5}, {1.0, 1.0});
+  BOOST_TEST(b12.position(0) == T(9.0));
+  BOOST_TEST(b12.position(1) == T(11.0));
+  // far from the lines, only the baseline remains
+  BOOST_TEST(li8(T(1e6)) == T(0.1), boost::test_tools::tolerance(T(1e-6)));
+  // the lines add up
+  const T x = 10.3;
+  T sum = 0.1;
+  for (unsigned int l = 0; l < Li8::n_lines; ++l) {
+    sum -= (l + 1) * resonance::voigt<T>(x, positions[l], T(0.5), T(0.2));
+  }
+  BOOST_TEST(li8(x) == sum,
+             boost::test_tools::tolerance(
+                 100 * std::numeric_limits<T>::epsilon()));
+}
+
+//
+BOOST_AUTO_TEST_CASE_TEMPLATE(spectrum_gradient, T, test_types) {
+  namespace nuclei = triumf::bnmr::nuclei;
+  const T step = std::cbrt(std::numeric_limits<T>::epsilon());
+  const T tolerance = std::max(T(1e-6), 100 * step * step);
+  // (spanning several blocks)
+  std::vector<T> frequency;
+  for (int i = 0; i < 600; ++i) {
+    frequency.push_back(T(0.025) * i - T(6.0));
+  }
+  // compare the batch evaluation against operator(), and the gradient
+  // against central differences
+  auto check = [&](auto model, const auto &par) {
+    using Model = decltype(model);
+    constexpr unsigned int n = Model::n_parameters;
+    BOOST_TEST(n == std::size(par));
+    std::vector<T> result, gradient, no_gradient;
+    Model(par.data()).evaluate(frequency, result, gradient);
+    Model(par.data()).evaluate(frequency, no_gradient);
+    BOOST_TEST(result.size() == frequency.size());
+    BOOST_TEST(gradient.size() == n * frequency.size());
+    for (std::size_t i = 0; i < frequency.size(); ++i) {
+      BOOST_TEST(no_gradient[i] == result[i]);
+      BOOST_TEST(result[i] == Model(par.data())(frequency[i]),
+                 boost::test_tools::tolerance(
+                     10 * std::numeric_limits<T>::epsilon()));
+      if (i % 7 != 0) {
+        continue;
+      }
+      T g[n];
+      BOOST_TEST(Model(par.data())(frequency[i], g) == result[i],
+                 boost::test_tools::tolerance(
+                     10 * std::numeric_limits<T>::epsilon()));
+      for (unsigned int j = 0; j < n; ++j) {
+        BOOST_TEST(g[j] == gradient[i * n + j],
+                   boost::test_tools::tolerance(
+                       10 * std::numeric_limits<T>::epsilon()));
+        std::array<T, n> p = par;
+        const T h = step * std::max(T(1.0), std::abs(par[j]));
+        p[j] = par[j] + h;
+        const T plus = Model(p.data())(frequency[i]);
+        p[j] = par[j] - h;
+        const T minus = Model(p.data())(frequency[i]);
+        BOOST_TEST(std::abs(g[j] - (plus - minus) / (2 * h)) <=
+                   tolerance * std::max(T(1.0), std::abs(g[j])));
+      }
+    }
+  };
+  //
+  check(resonance::Resonance<resonance::Lorentzian, T>(T(0.1), T(1.0),
+                                                       T(1.0), {T(0.4)}),
+        std::array<T, 4>{0.1, 1.0, 1.0, 0.4});
+  check(resonance::Resonance<resonance::Voigt, T>(T(0.1), T(1.0), T(1.0),
+                                                  {T(0.4), T(0.3)}),
+        std::array<T, 5>{0.1, 1.0, 1.0, 0.4, 0.3});
+  check(resonance::Resonance<resonance::PseudoVoigt, T>(
+            T(0.1), T(1.0), T(1.0), {T(0.6), T(0.5)}),
+        std::array<T, 5>{0.1, 1.0, 1.0, 0.6, 0.5});
+  check(resonance::QuadrupoleSplitResonance<resonance::Voigt,
+                                            nuclei::lithium_8, T>(
+            T(0.1), T(1.0), T(2.5), {T(0.4), T(0.3)},
+            {T(1.0), T(0.5), T(0.8), T(0.2)}),
+        std::array<T, 9>{0.1, 1.0, 2.5, 0.4, 0.3, 1.0, 0.5, 0.8, 0.2});
+  check(resonance::QuadrupoleSplitResonance<resonance::Gaussian,
+                                            nuclei::boron_12, T>(
+            T(0.1), T(1.0), T(1.5), {T(0.4)}, {T(1.0), T(0.5)}),
+        std::array<T, 6>{0.1, 1.0, 1.5, 0.4, 1.0, 0.5});
+}
@@ -1,7 +1,12 @@
 #define BOOST_TEST_MODULE BNMR_SLR
 #include <boost/test/included/unit_test.hpp>
 
+#include <algorithm>
+#include <boost/math/quadrature/tanh_sinh.hpp>
 #include <cmath>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
 #include <triumf/bnmr/nuclei.hpp>
 #include <triumf/bnmr/slr/bi_exp.hpp>
 #include <triumf/bnmr/slr/cbrt_exp.hpp>
@@ -14,6 +19,7 @@
 #include <triumf/bnmr/slr/str_exp.hpp>
 #include <triumf/numpy.hpp>
 #include <tuple>
+#include <vector>
 
 typedef std::tuple<float, double, long double> test_types;
 
@@ -60,6 +66,83 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(pulsed_exp_31mg, T, test_types) {
                    time, nuclear_lifetime, pulse_length, initial_asymmetry,
                    slr_rate) <= initial_asymmetry);
   }
+  // the (per-thread) decay corrections follow changes of the pulse length
+  for (const T time : {T(0.5), T(2.0), T(8.0)}) {
+    for (const T pulse : {T(1.0), T(4.0), T(1.0), T(0.5)}) {
+      BOOST_TEST(triumf::bnmr::slr::magnesium_31::pulsed_exp<T>(
+                     time, nuclear_lifetime, pulse, initial_asymmetry,
+                     slr_rate) ==
+                 triumf::bnmr::slr::magnesium_31::DecayCorrections<T>(pulse)(
+                     time) *
+                     triumf::bnmr::slr::pulsed_exp<T>(time, nuclear_lifetime,
+                                                      pulse, initial_asymmetry,
+                                                      slr_rate));
+    }
+  }
+}
+
+//
+BOOST_AUTO_TEST_CASE_TEMPLATE(decay_corrections_31mg, T, test_types) {
+  namespace magnesium_31 = triumf::bnmr::slr::magnesium_31;
+  using Nuclide = typename magnesium_31::DecayCorrections<T>::Nuclide;
+  const T tolerance =
+      std::max(T(1e-9), 1000 * std::numeric_limits<T>::epsilon());
+  const std::vector<T> time = triumf::numpy::linspace<T>(-1.0, 16.0, 171);
+  //
+  for (const T pulse_length : {T(0.5), T(1.0), T(4.0)}) {
+    const magnesium_31::DecayCorrections<T> corrections(pulse_length);
+    // the limit time -> 0+
+    BOOST_TEST(corrections(-1.0) == 1.0);
+    BOOST_TEST(corrections(0.0) == 1.0);
+    BOOST_TEST(corrections.activity(Nuclide::aluminum_31, 0.0) == 0.0);
+    // batch evaluation
+    const std::vector<T> fraction = corrections(time);
+    BOOST_TEST(fraction.size() == time.size());
+    for (std::size_t i = 0; i < time.size(); ++i) {
+      BOOST_TEST(fraction[i] == corrections(time[i]));
+    }
+    // compare against the closed forms (whose silicon-31 activity suffers
+    // from cancellation at early times)
+    for (const T t : triumf::numpy::linspace<T>(0.05, 16.0, 320)) {
+      const double p = pulse_length;
+      const double beam_rate = 1e6;
+      BOOST_TEST(corrections(t) == T(magnesium_31::fa_31Mg(t, p, beam_rate)),
+                 boost::test_tools::tolerance(tolerance));
+      BOOST_TEST(corrections.fractional_activity(Nuclide::aluminum_31, t) ==
+                     T(magnesium_31::fa_31Al(t, p, beam_rate)),
+                 boost::test_tools::tolerance(tolerance));
+      BOOST_TEST(corrections.fractional_activity(Nuclide::aluminum_30, t) ==
+                     T(magnesium_31::fa_30Al(t, p, beam_rate)),
+                 boost::test_tools::tolerance(tolerance));
+      BOOST_TEST(corrections.activity(Nuclide::magnesium_31, t) ==
+                     T(magnesium_31::a_31Mg(t, p, beam_rate)),
+                 boost::test_tools::tolerance(tolerance));
+      BOOST_TEST(corrections.activity(Nuclide::aluminum_31, t) ==
+                     T(magnesium_31::a_31Al(t, p, beam_rate)),
+                 boost::test_tools::tolerance(tolerance));
+      if (t >= 0.5) {
+        BOOST_TEST(corrections.fractional_activity(Nuclide::silicon_31, t) ==
+                       T(magnesium_31::fa_31Si(t, p, beam_rate)),
+                   boost::test_tools::tolerance(T(1e3) * tolerance));
+      }
+      // the fractions add up to one & are independent of the beam rate
+      T sum = 0.0;
+      for (const Nuclide nuclide :
+           {Nuclide::magnesium_31, Nuclide::aluminum_31, Nuclide::silicon_31,
+            Nuclide::aluminum_30}) {
+        sum += corrections.fractional_activity(nuclide, t);
+      }
+      BOOST_TEST(sum == T(1.0), boost::test_tools::tolerance(tolerance));
+      BOOST_TEST(magnesium_31::DecayCorrections<T>(pulse_length, 1.0)(t) ==
+                     corrections(t),
+                 boost::test_tools::tolerance(tolerance));
+    }
+  }
+  //
+  BOOST_CHECK_THROW(magnesium_31::DecayCorrections<T>(0.0),
+                    std::domain_error);
+  BOOST_CHECK_THROW(magnesium_31::DecayCorrections<T>(-1.0),
+                    std::domain_error);
 }
 
 //
@@ -82,6 +165,30 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(pulsed_sq_exp, T, test_types) {
                    time, nuclear_lifetime, pulse_length, initial_asymmetry,
                    slr_rate) <= initial_asymmetry);
   }
+  // slow rates (where exp(1 / (2 slr_rate nuclear_lifetime)^2) overflows)
+  // approach the unrelaxed asymmetry
+  const T tolerance =
+      std::max(T(1e-6), 1000 * std::numeric_limits<T>::epsilon());
+  for (const T slow_rate : {T(0.1), T(0.01), T(1e-4)}) {
+    const T exp_par[] = {nuclear_lifetime, pulse_length, initial_asymmetry,
+                         slow_rate};
+    const triumf::bnmr::slr::PulsedSqExp<T> model(exp_par);
+    for (const T time : {T(0.5), T(2.0), T(4.0), T(8.0)}) {
+      const T value = triumf::bnmr::slr::pulsed_sq_exp<T>(
+          time, nuclear_lifetime, pulse_length, initial_asymmetry, slow_rate);
+      BOOST_TEST(std::isfinite(value));
+      BOOST_TEST(value <= initial_asymmetry);
+      BOOST_TEST(value >= (1.0 - tolerance) *
+                              std::exp(-slow_rate * slow_rate * time * time));
+      BOOST_TEST(model(time) == value, boost::test_tools::tolerance(tolerance));
+      T gradient[4];
+      BOOST_TEST(model(time, gradient) == value,
+                 boost::test_tools::tolerance(tolerance));
+      for (const T g : gradient) {
+        BOOST_TEST(std::isfinite(g));
+      }
+    }
+  }
 }
 
 //
@@ -152,6 +259,53 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(pulsed_str_exp, T, test_types) {
   }
 }
 
+//
+BOOST_AUTO_TEST_CASE_TEMPLATE(pulsed_str_exp_fast, T, test_types) {
+  //
+  constexpr T pulse_length = 4.0;
+  constexpr T nuclear_lifetime = triumf::bnmr::nuclei::lithium_8<T>::lifetime();
+  constexpr T initial_asymmetry = 1.0;
+  const T tolerance =
+      std::max(T(1e-9), 1000 * std::numeric_limits<T>::epsilon());
+  const std::vector<T> time = triumf::numpy::linspace<T>(-1.0, 16.0, 171);
+  // adaptive (tanh-sinh) reference integral
+  auto reference = [&](T t, T t_p, T slr_rate, T beta) {
+    auto integrand = [=](long double u) {
+      return std::exp(-u / nuclear_lifetime) *
+             std::exp(-std::pow(slr_rate * u, (long double)beta));
+    };
+    boost::math::quadrature::tanh_sinh<long double> integrator;
+    return static_cast<T>(integrator.integrate(
+        integrand, (long double)(t - t_p), (long double)t));
+  };
+  //
+  for (const T slr_rate : {T(0.1), T(1.0), T(25.0)}) {
+    for (const T beta : {T(0.2), T(0.5), T(0.8), T(1.0), T(1.5)}) {
+      // the fixed-rule integral agrees with the adaptive one
+      for (const T t : {T(0.01), T(0.5), T(4.0), T(4.01), T(6.0), T(12.0)}) {
+        const T t_p = std::min(t, pulse_length);
+        BOOST_TEST(triumf::bnmr::slr::pulsed_str_exp_integral<T>(
+                       t, t_p, nuclear_lifetime, slr_rate, beta) ==
+                       reference(t, t_p, slr_rate, beta),
+                   boost::test_tools::tolerance(tolerance));
+      }
+      // the batch evaluation agrees with the point-wise one
+      std::vector<T> asymmetry;
+      triumf::bnmr::slr::pulsed_str_exp<T>(time, nuclear_lifetime,
+                                           pulse_length, initial_asymmetry,
+                                           slr_rate, beta, asymmetry);
+      BOOST_TEST(asymmetry.size() == time.size());
+      for (std::size_t i = 0; i < time.size(); ++i) {
+        BOOST_TEST(asymmetry[i] ==
+                       triumf::bnmr::slr::pulsed_str_exp<T>(
+                           time[i], nuclear_lifetime, pulse_length,
+                           initial_asymmetry, slr_rate, beta),
+                   boost::test_tools::tolerance(tolerance));
+      }
+    }
+  }
+}
+
 //
 BOOST_AUTO_TEST_CASE_TEMPLATE(pulsed_mod_str_exp, T, test_types) {
   //
@@ -228,3 +382,206 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(pulsed_gauss_dist_exp, T, test_types) {
     }
   }
 }
+
+//
+BOOST_AUTO_TEST_CASE_TEMPLATE(pulsed_evaluate, T, test_types) {
+  //
+  constexpr T pulse_length = 4.0;
+  constexpr T nuclear_lifetime = triumf::bnmr::nuclei::lithium_8<T>::lifetime();
+  constexpr T initial_asymmetry = 1.0;
+  const T tolerance =
+      std::max(T(1e-8), 1000 * std::numeric_limits<T>::epsilon());
+  const std::vector<T> time = triumf::numpy::linspace<T>(-1.0, 16.0, 171);
+  std::vector<T> asymmetry;
+  // compare the batch evaluation against the point-wise model
+  auto check = [&](auto model) {
+    BOOST_TEST(asymmetry.size() == time.size());
+    for (std::size_t i = 0; i < time.size(); ++i) {
+      BOOST_TEST(std::abs(asymmetry[i] - model(time[i])) <=
+                 tolerance * initial_asymmetry);
+    }
+  };
+  //
+  for (const T slr_rate : {T(0.1), T(1.0), T(10.0)}) {
+    const T exp_par[] = {nuclear_lifetime, pulse_length, initial_asymmetry,
+                         slr_rate};
+    triumf::bnmr::slr::evaluate<triumf::bnmr::slr::PulsedExp<T>>(
+        time, exp_par, asymmetry);
+    check([&](T t) { return triumf::bnmr::slr::pulsed_exp<T>(&t, exp_par); });
+    triumf::bnmr::slr::evaluate<
+        triumf::bnmr::slr::magnesium_31::PulsedExp<T>>(time, exp_par,
+                                                       asymmetry);
+    check([&](T t) {
+      return triumf::bnmr::slr::magnesium_31::pulsed_exp<T>(&t, exp_par);
+    });
+    triumf::bnmr::slr::evaluate<triumf::bnmr::slr::PulsedSqExp<T>>(
+        time, exp_par, asymmetry);
+    check(
+        [&](T t) { return triumf::bnmr::slr::pulsed_sq_exp<T>(&t, exp_par); });
+    triumf::bnmr::slr::evaluate<triumf::bnmr::slr::PulsedSqrtExp<T>>(
+        time, exp_par, asymmetry);
+    check([&](T t) {
+      return triumf::bnmr::slr::pulsed_sqrt_exp<T>(&t, exp_par);
+    });
+    triumf::bnmr::slr::evaluate<triumf::bnmr::slr::PulsedCbrtExp<T>>(
+        time, exp_par, asymmetry);
+    check([&](T t) {
+      return triumf::bnmr::slr::pulsed_cbrt_exp<T>(&t, exp_par);
+    });
+    //
+    const T str_exp_par[] = {nuclear_lifetime, pulse_length,
+                             initial_asymmetry, slr_rate, 0.6};
+    triumf::bnmr::slr::evaluate<triumf::bnmr::slr::PulsedStrExp<T>>(
+        time, str_exp_par, asymmetry);
+    check([&](T t) {
+      return triumf::bnmr::slr::pulsed_str_exp<T>(&t, str_exp_par);
+    });
+    //
+    const T bi_exp_par[] = {nuclear_lifetime, pulse_length, initial_asymmetry,
+                            0.75, slr_rate, 10.0};
+    triumf::bnmr::slr::evaluate<triumf::bnmr::slr::PulsedBiExp<T>>(
+        time, bi_exp_par, asymmetry);
+    check([&](T t) {
+      return triumf::bnmr::slr::pulsed_bi_exp<T>(&t, bi_exp_par);
+    });
+    //
+    const T mod_str_exp_par[] = {nuclear_lifetime,  pulse_length,
+                                 initial_asymmetry, T(2.0) * slr_rate,
+                                 slr_rate,          0.5};
+    triumf::bnmr::slr::evaluate<triumf::bnmr::slr::PulsedModStrExp<T>>(
+        time, mod_str_exp_par, asymmetry);
+    check([&](T t) {
+      return triumf::bnmr::slr::pulsed_mod_str_exp<T>(&t, mod_str_exp_par);
+    });
+    // (the point-wise integrand overflows in single precision for fast rates)
+    if (slr_rate <= 1.0) {
+      const T gauss_dist_exp_par[] = {nuclear_lifetime, pulse_length,
+                                      initial_asymmetry, slr_rate,
+                                      T(0.1) * slr_rate};
+      triumf::bnmr::slr::evaluate<triumf::bnmr::slr::PulsedGaussDistExp<T>>(
+          time, gauss_dist_exp_par, asymmetry);
+      check([&](T t) {
+        return triumf::bnmr::slr::pulsed_gauss_dist_exp<T>(
+            &t, gauss_dist_exp_par);
+      });
+    }
+  }
+}
+
+//
+BOOST_AUTO_TEST_CASE_TEMPLATE(pulsed_gradient, T, test_types) {
+  //
+  constexpr T pulse_length = 4.0;
+  constexpr T nuclear_lifetime = triumf::bnmr::nuclei::lithium_8<T>::lifetime();
+  constexpr T initial_asymmetry = 1.0;
+  const T step = std::cbrt(std::numeric_limits<T>::epsilon());
+  const T tolerance = std::max(T(1e-6), 100 * step * step);
+  // compare the gradient against central differences
+  auto check = [&](auto model, const auto &par) {
+    using Model = decltype(model);
+    constexpr unsigned int n = Model::n_parameters;
+    BOOST_TEST(n == std::size(par));
+    for (const T time : {T(0.0), T(0.5), T(2.0), T(3.5), T(6.0), T(12.0)}) {
+      T gradient[n];
+      BOOST_TEST(Model(par)(time, gradient) == Model(par)(time),
+                 boost::test_tools::tolerance(tolerance));
+      for (unsigned int i = 0; i < n; ++i) {
+        T p[n];
+        std::copy(std::begin(par), std::end(par), p);
+        const T h = step * std::max(T(1.0), std::abs(par[i]));
+        p[i] = par[i] + h;
+        const T plus = Model(p)(time);
+        p[i] = par[i] - h;
+        const T minus = Model(p)(time);
+        BOOST_TEST(std::abs(gradient[i] - (plus - minus) / (2 * h)) <=
+                   tolerance * std::max(T(1.0), std::abs(gradient[i])));
+      }
+    }
+  };
+  //
+  for (const T slr_rate : {T(0.1), T(1.0), T(5.0)}) {
+    const T exp_par[] = {nuclear_lifetime, pulse_length, initial_asymmetry,
+                         slr_rate};
+    check(triumf::bnmr::slr::PulsedExp<T>(exp_par), exp_par);
+    check(triumf::bnmr::slr::magnesium_31::PulsedExp<T>(exp_par), exp_par);
+    check(triumf::bnmr::slr::PulsedSqExp<T>(exp_par), exp_par);
+    check(triumf::bnmr::slr::PulsedSqrtExp<T>(exp_par), exp_par);
+    check(triumf::bnmr::slr::PulsedCbrtExp<T>(exp_par), exp_par);
+    //
+    const T str_exp_par[] = {nuclear_lifetime, pulse_length,
+                             initial_asymmetry, slr_rate, 0.6};
+    check(triumf::bnmr::slr::PulsedStrExp<T>(str_exp_par), str_exp_par);
+    //
+    const T bi_exp_par[] = {nuclear_lifetime, pulse_length, initial_asymmetry,
+                            0.75, slr_rate, 10.0};
+    check(triumf::bnmr::slr::PulsedBiExp<T>(bi_exp_par), bi_exp_par);
+    //
+    const T mod_str_exp_par[] = {nuclear_lifetime,  pulse_length,
+                                 initial_asymmetry, T(2.0) * slr_rate,
+                                 slr_rate,          0.5};
+    check(triumf::bnmr::slr::PulsedModStrExp<T>(mod_str_exp_par),
+          mod_str_exp_par);
+    //
+    const T gauss_dist_exp_par[] = {nuclear_lifetime, pulse_length,
+                                    initial_asymmetry, slr_rate,
+                                    T(0.1) * slr_rate};
+    check(triumf::bnmr::slr::PulsedGaussDistExp<T>(gauss_dist_exp_par),
+          gauss_dist_exp_par);
+  }
+  // the magnesium-31 decay corrections are differentiated numerically (with a
+  // step suited to T), so compare against the double precision gradient
+  const T reference_tolerance =
+      std::max(T(1e-9), 1000 * std::numeric_limits<T>::epsilon());
+  for (const double slr_rate : {0.1, 1.0, 5.0}) {
+    const T par[] = {nuclear_lifetime, pulse_length, initial_asymmetry,
+                     T(slr_rate)};
+    const double reference_par[] = {double(nuclear_lifetime),
+                                    double(pulse_length),
+                                    double(initial_asymmetry), slr_rate};
+    const triumf::bnmr::slr::magnesium_31::PulsedExp<T> model(par);
+    const triumf::bnmr::slr::magnesium_31::PulsedExp<double> reference(
+        reference_par);
+    for (const double time : {0.5, 2.0, 3.5, 4.5, 6.0, 12.0}) {
+      T gradient[4];
+      double reference_gradient[4];
+      model(T(time), gradient);
+      reference(time, reference_gradient);
+      for (unsigned int i = 0; i < 4; ++i) {
+        BOOST_TEST(std::abs(gradient[i] - T(reference_gradient[i])) <=
+                   reference_tolerance *
+                       std::max(T(1.0), std::abs(T(reference_gradient[i]))));
+      }
+    }
+  }
+  // at slr_rate = 0 (e.g., a fit's lower bound), where the derivative with
+  // respect to slr_rate is finite for beta = 1 (i.e., that of an exponential)
+  // and vanishes for beta > 1
+  const T str_exp_par[] = {nuclear_lifetime, pulse_length, initial_asymmetry,
+                           0.0, 1.0};
+  check(triumf::bnmr::slr::PulsedStrExp<T>(str_exp_par), str_exp_par);
+  const T exp_par[] = {nuclear_lifetime, pulse_length, initial_asymmetry, 0.0};
+  const triumf::bnmr::slr::PulsedStrExp<T> str_exp(str_exp_par);
+  const triumf::bnmr::slr::PulsedExp<T> exp(exp_par);
+  for (const T time : {T(2.0), T(6.0)}) {
+    T gradient[5];
+    T exp_gradient[4];
+    str_exp(time, gradient);
+    exp(time, exp_gradient);
+    BOOST_TEST(gradient[3] < 0.0);
+    BOOST_TEST(gradient[3] == exp_gradient[3],
+               boost::test_tools::tolerance(tolerance));
+    const T steep_par[] = {nuclear_lifetime, pulse_length, initial_asymmetry,
+                           0.0, 1.5};
+    const triumf::bnmr::slr::PulsedStrExp<T> steep(steep_par);
+    steep(time, gradient);
+    BOOST_TEST(gradient[3] == 0.0);
+    // (a forward difference, which vanishes as sqrt(h))
+    T p[5];
+    std::copy(std::begin(steep_par), std::end(steep_par), p);
+    p[3] = step * step;
+    const T forward =
+        (triumf::bnmr::slr::PulsedStrExp<T>(p)(time) - steep(time)) / p[3];
+    BOOST_TEST(forward <= 0.0);
+    BOOST_TEST(-forward <= 10 * std::sqrt(p[3]));
+  }
+}
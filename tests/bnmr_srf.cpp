@@ -0,0 +1,233 @@
+#define BOOST_TEST_MODULE BNMR_SRF
+#include <boost/test/included/unit_test.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <Fit/BinData.h>
+
+#include <triumf/bnmr/srf/chi2.hpp>
+#include <triumf/bnmr/srf/local.hpp>
+#include <triumf/bnmr/srf/nonlocal.hpp>
+
+// (ROOT is needed to read the stopping profile's CSV file; n.b., the path is
+// relative to the top of the repository)
+const std::string csv_filename = "examples/srim_profile_8li_nb_fitpar.csv";
+
+namespace {
+
+/// Return the number of concurrent evaluations (operator() & gauss_jacobi)
+/// that differ from the serial ones, for each (parameters, energy) pair.
+template <typename Analyzer, typename Parameters>
+std::size_t concurrent_mismatches(const Analyzer &serial,
+                                  const Analyzer &concurrent,
+                                  const std::vector<Parameters> &parameters,
+                                  const std::vector<double> &energies) {
+  const std::size_t n = parameters.size() * energies.size();
+  std::vector<double> adaptive(n);
+  std::vector<double> fixed(n);
+  for (std::size_t k = 0; k < n; ++k) {
+    const Parameters &p = parameters[k / energies.size()];
+    const double energy = energies[k % energies.size()];
+    adaptive[k] = serial(energy, p);
+    fixed[k] = serial.gauss_jacobi(energy, p);
+  }
+  // each thread evaluates every pair, starting at a different one
+  const std::size_t n_threads = 4;
+  std::atomic<std::size_t> mismatches{0};
+  std::vector<std::thread> threads;
+  for (std::size_t t = 0; t < n_threads; ++t) {
+    threads.emplace_back([&, t]() {
+      for (std::size_t i = 0; i < n; ++i) {
+        const std::size_t k = (i + t * n / n_threads) % n;
+        const Parameters &p = parameters[k / energies.size()];
+        const double energy = energies[k % energies.size()];
+        if (concurrent(energy, p) != adaptive[k]) {
+          ++mismatches;
+        }
+        if (concurrent.gauss_jacobi(energy, p) != fixed[k]) {
+          ++mismatches;
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  return mismatches.load();
+}
+
+/// (temperature, applied field, energy) grid, flattened (energies vary
+/// fastest, with repeats)
+struct Grid {
+  Grid(const std::vector<double> &grid_temperatures,
+       const std::vector<double> &grid_applied_fields,
+       const std::vector<double> &grid_energies) {
+    for (const double t : grid_temperatures) {
+      for (const double b : grid_applied_fields) {
+        for (const double e : grid_energies) {
+          temperatures.push_back(t);
+          applied_fields.push_back(b);
+          energies.push_back(e);
+        }
+      }
+    }
+  };
+
+  std::vector<double> temperatures;
+  std::vector<double> applied_fields;
+  std::vector<double> energies;
+};
+
+/// Return the number of batch rates that differ from the single-point ones.
+template <typename Analyzer, typename Parameters>
+std::size_t batch_mismatches(const Analyzer &analyzer, const Grid &grid,
+                             const Parameters &parameters) {
+  std::vector<double> rates;
+  analyzer(grid.temperatures, grid.applied_fields, grid.energies, parameters,
+           rates);
+  BOOST_TEST(rates.size() == grid.energies.size());
+  std::size_t mismatches = 0;
+  for (std::size_t i = 0; i < rates.size(); ++i) {
+    Parameters p = parameters;
+    p.temperature = grid.temperatures[i];
+    p.applied_field = grid.applied_fields[i];
+    if (rates[i] != analyzer(grid.energies[i], p)) {
+      ++mismatches;
+    }
+  }
+  return mismatches;
+}
+
+} // namespace
+
+//
+BOOST_AUTO_TEST_CASE(local_depth_resolved_analyzer_concurrent) {
+  namespace local = triumf::bnmr::srf::local;
+  const local::DepthResolvedAnalyzer<double> serial(csv_filename);
+  const local::DepthResolvedAnalyzer<double> concurrent(csv_filename);
+  std::vector<local::Parameters<double>> parameters(3, serial.parameters());
+  parameters[1].temperature = 4.5;
+  parameters[2].lambda_0 = 50.0;
+  BOOST_TEST(concurrent_mismatches(serial, concurrent, parameters,
+                                   {1.0, 5.0, 10.0, 20.0}) == 0);
+}
+
+//
+BOOST_AUTO_TEST_CASE(nonlocal_depth_resolved_analyzer_concurrent) {
+  namespace nonlocal = triumf::bnmr::srf::nonlocal;
+  std::vector<nonlocal::Parameters<double>> parameters(2);
+  parameters[1].temperature = 4.5;
+  // w/o & w/ the (shared) field profile cache
+  for (const std::size_t capacity : {0, 8}) {
+    nonlocal::DepthResolvedAnalyzer<double> serial(csv_filename);
+    nonlocal::DepthResolvedAnalyzer<double> concurrent(csv_filename);
+    serial.set_field_profile_cache_capacity(capacity);
+    concurrent.set_field_profile_cache_capacity(capacity);
+    BOOST_TEST(concurrent_mismatches(serial, concurrent, parameters,
+                                     {2.0, 10.0}) == 0);
+  }
+}
+
+//
+BOOST_AUTO_TEST_CASE(local_depth_resolved_analyzer_batch) {
+  namespace local = triumf::bnmr::srf::local;
+  const local::DepthResolvedAnalyzer<double> analyzer(csv_filename);
+  // (including the normal state)
+  const Grid grid({2.5, 12.0}, {0.02, 0.1}, {1.0, 5.0, 1.0});
+  BOOST_TEST(batch_mismatches(analyzer, grid, local::Parameters<double>()) ==
+             0);
+}
+
+//
+BOOST_AUTO_TEST_CASE(nonlocal_depth_resolved_analyzer_batch) {
+  namespace nonlocal = triumf::bnmr::srf::nonlocal;
+  const nonlocal::DepthResolvedAnalyzer<double> analyzer(csv_filename);
+  const Grid grid({2.5, 4.5}, {0.02}, {2.0, 10.0, 2.0});
+  BOOST_TEST(batch_mismatches(analyzer, grid, nonlocal::Parameters<double>()) ==
+             0);
+}
+
+//
+BOOST_AUTO_TEST_CASE(batch_chi2_function) {
+  namespace local = triumf::bnmr::srf::local;
+  using Chi2 =
+      triumf::bnmr::srf::BatchChi2Function<local::DepthResolvedAnalyzer<double>,
+                                           local::Parameters<double>>;
+  const local::DepthResolvedAnalyzer<double> analyzer(csv_filename);
+  // fit parameters: (lambda_0, slr_constant)
+  auto map_parameters = [](const double *par) {
+    local::Parameters<double> p;
+    p.lambda_0 = par[0];
+    p.slr_constant = par[1];
+    return p;
+  };
+  // the single-point rate
+  auto rate = [&](const double *par, double temperature, double applied_field,
+                  double energy) {
+    local::Parameters<double> p = map_parameters(par);
+    p.temperature = temperature;
+    p.applied_field = applied_field;
+    return analyzer(energy, p);
+  };
+  // data from the "true" parameters (with some deterministic "noise")
+  const double truth[] = {40.0, 0.75};
+  const Grid grid({2.5, 12.0}, {0.02}, {2.0, 10.0});
+  const std::size_t n = grid.energies.size();
+  ROOT::Fit::BinData data(n, 3);
+  std::vector<double> values(n);
+  std::vector<double> errors(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    const double x[] = {grid.temperatures[i], grid.applied_fields[i],
+                        grid.energies[i]};
+    const double r = rate(truth, x[0], x[1], x[2]);
+    errors[i] = 0.02 * r;
+    values[i] = r + errors[i] * std::sin(1.3 * i);
+    data.Add(x, values[i], errors[i]);
+  }
+  const Chi2 chi2(analyzer, data, 2, map_parameters);
+  BOOST_TEST(chi2.NDim() == 2);
+  BOOST_TEST(chi2.NPoints() == n);
+  // the hand-summed chi^2
+  auto chi2_sum = [&](const double *par) {
+    double sum = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+      const double residual =
+          (values[i] - rate(par, grid.temperatures[i], grid.applied_fields[i],
+                            grid.energies[i])) /
+          errors[i];
+      sum += residual * residual;
+    }
+    return sum;
+  };
+  // (away from the minimum)
+  double par[] = {45.0, 0.8};
+  BOOST_TEST(chi2(par) == chi2_sum(par), boost::test_tools::tolerance(1e-12));
+  // the gradient vs. (independent) central differences
+  double gradient[2];
+  chi2.Gradient(par, gradient);
+  for (std::size_t k = 0; k < 2; ++k) {
+    const double p_k = par[k];
+    const double h = 1e-4 * std::max(1.0, std::abs(p_k));
+    par[k] = p_k + h;
+    const double chi2_plus = chi2_sum(par);
+    par[k] = p_k - h;
+    const double chi2_minus = chi2_sum(par);
+    par[k] = p_k;
+    BOOST_TEST(gradient[k] == (chi2_plus - chi2_minus) / (2.0 * h),
+               boost::test_tools::tolerance(1e-3));
+  }
+  // the data coordinates must be (temperature, applied field, energy)
+  ROOT::Fit::BinData wrong(2, 2);
+  const double x[] = {2.5, 5.0};
+  wrong.Add(x, 1.0, 0.1);
+  wrong.Add(x, 1.0, 0.1);
+  BOOST_CHECK_THROW(Chi2(analyzer, wrong, 2, map_parameters),
+                    std::invalid_argument);
+}
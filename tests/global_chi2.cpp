@@ -0,0 +1,374 @@
+#define BOOST_TEST_MODULE GLOBAL_CHI2
+#include <boost/test/included/unit_test.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <Fit/BinData.h>
+#include <Fit/Chi2FCN.h>
+
+#include <triumf/bnmr/nuclei.hpp>
+#include <triumf/bnmr/slr/exp.hpp>
+#include <triumf/bnmr/slr/param_grad_function.hpp>
+#include <triumf/global_chi2.hpp>
+#include <triumf/numpy.hpp>
+
+// (ROOT is double only)
+namespace {
+
+/// n simulated lithium-8 SLR datasets sharing the lifetime & pulse length,
+/// each with its own (asymmetry, rate), as chi2 functions with and without
+/// their own gradients
+class Datasets {
+public:
+  typedef triumf::bnmr::slr::ParamGradFunction<
+      triumf::bnmr::slr::PulsedExp<double>>
+      Model;
+
+  explicit Datasets(std::size_t n) {
+    const double lifetime =
+        triumf::bnmr::nuclei::lithium_8<double>::lifetime();
+    const double pulse_length = 4.0;
+    const std::vector<double> time =
+        triumf::numpy::linspace<double>(0.05, 15.95, 160);
+    // global parameters: lifetime, pulse length, then (asymmetry, rate) pairs
+    par = {lifetime, pulse_length};
+    data.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      const double local_par[] = {lifetime, pulse_length, 0.1,
+                                  0.05 * (i + 1.0)};
+      std::vector<double> asymmetry(time.size());
+      std::vector<double> error(time.size());
+      for (std::size_t j = 0; j < time.size(); ++j) {
+        error[j] = 0.01 * local_par[2];
+        // (with some deterministic "noise")
+        asymmetry[j] = triumf::bnmr::slr::pulsed_exp<double>(&time[j],
+                                                             local_par) +
+                       error[j] * std::sin(1.3 * j + i);
+      }
+      data.emplace_back(time.size(), time.data(), asymmetry.data(), nullptr,
+                        error.data());
+      parameter_index.push_back({0, 1, static_cast<int>(par.size()),
+                                 static_cast<int>(par.size() + 1)});
+      // (starting away from the "truth")
+      par.push_back(1.1 * local_par[2]);
+      par.push_back(0.9 * local_par[3]);
+    }
+    chi2_functions.reserve(n);
+    chi2_grad_functions.reserve(n);
+    for (const auto &d : data) {
+      chi2_functions.emplace_back(d, model);
+      chi2_grad_functions.emplace_back(d, model);
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+      chi2.push_back(&chi2_functions[i]);
+      chi2_grad.push_back(&chi2_grad_functions[i]);
+    }
+  };
+
+  Datasets(const Datasets &) = delete;
+  Datasets &operator=(const Datasets &) = delete;
+
+  std::vector<double> par;
+  std::vector<std::vector<int>> parameter_index;
+  std::vector<ROOT::Fit::Chi2Function *> chi2;
+  std::vector<ROOT::Fit::Chi2GradFunction *> chi2_grad;
+
+private:
+  const Model model;
+  std::vector<ROOT::Fit::BinData> data;
+  std::vector<ROOT::Fit::Chi2Function> chi2_functions;
+  std::vector<ROOT::Fit::Chi2GradFunction> chi2_grad_functions;
+};
+
+/// chi2 function that counts its evaluations
+class CountedChi2 : public ROOT::Math::IMultiGenFunction {
+public:
+  explicit CountedChi2(const ROOT::Math::IMultiGenFunction *chi2,
+                       std::atomic<std::size_t> *count)
+      : _chi2(chi2), _count(count){};
+
+  CountedChi2 *Clone() const override { return new CountedChi2(*this); };
+
+  unsigned int NDim() const override { return _chi2->NDim(); };
+
+private:
+  double DoEval(const double *par) const override {
+    ++*_count;
+    return (*_chi2)(par);
+  };
+
+  const ROOT::Math::IMultiGenFunction *_chi2;
+  std::atomic<std::size_t> *_count;
+};
+
+/// central-difference gradient of the (serial) global chi2
+std::vector<double> numerical_gradient(const triumf::global_chi2 &chi2,
+                                       std::vector<double> par) {
+  std::vector<double> gradient(par.size());
+  for (std::size_t k = 0; k < par.size(); ++k) {
+    const double p_k = par[k];
+    const double h = 1e-6 * std::max(1.0, std::abs(p_k));
+    par[k] = p_k + h;
+    const double chi2_plus = chi2(par.data());
+    par[k] = p_k - h;
+    const double chi2_minus = chi2(par.data());
+    par[k] = p_k;
+    gradient[k] = (chi2_plus - chi2_minus) / (2.0 * h);
+  }
+  return gradient;
+}
+
+} // namespace
+
+//
+BOOST_AUTO_TEST_CASE(parallel_global_chi2_value) {
+  Datasets datasets(60);
+  std::vector<double> par_changed = datasets.par;
+  par_changed[0] *= 1.0 + 1e-6;
+  const triumf::global_chi2 serial(datasets.chi2, datasets.parameter_index);
+  const double expected = serial(datasets.par.data());
+  const double expected_changed = serial(par_changed.data());
+  BOOST_TEST(expected != expected_changed);
+  // summed in dataset order, i.e., identical for any number of threads
+  for (unsigned int n_threads : {1u, 2u, 4u, 8u}) {
+    const triumf::parallel_global_chi2 parallel(
+        datasets.chi2, datasets.parameter_index, n_threads);
+    BOOST_TEST(parallel.size() == 60);
+    BOOST_TEST(parallel.NDim() == datasets.par.size());
+    BOOST_TEST(parallel.n_threads() == n_threads);
+    for (int repeat = 0; repeat < 2; ++repeat) {
+      BOOST_TEST(parallel(datasets.par.data()) == expected);
+      BOOST_TEST(parallel(par_changed.data()) == expected_changed);
+    }
+    const std::unique_ptr<triumf::parallel_global_chi2> clone(
+        parallel.Clone());
+    BOOST_TEST(clone->n_threads() == n_threads);
+    BOOST_TEST((*clone)(datasets.par.data()) == expected);
+  }
+}
+
+//
+BOOST_AUTO_TEST_CASE(parallel_global_chi2_gradient) {
+  Datasets datasets(60);
+  const std::size_t n_par = datasets.par.size();
+  const triumf::global_chi2 serial(datasets.chi2, datasets.parameter_index);
+  const std::vector<double> expected =
+      numerical_gradient(serial, datasets.par);
+  double scale = 0.0;
+  for (double g : expected) {
+    scale = std::max(scale, std::abs(g));
+  }
+  BOOST_TEST(scale > 0.0);
+  // datasets w/o (central differences) & w/ their own gradients
+  const triumf::parallel_global_chi2 reference(
+      datasets.chi2, datasets.parameter_index, 1);
+  BOOST_TEST(not reference.has_gradients());
+  const triumf::parallel_global_chi2 reference_grad(
+      datasets.chi2_grad, datasets.parameter_index, 1);
+  BOOST_TEST(reference_grad.has_gradients());
+  std::vector<double> gradient(n_par);
+  std::vector<double> gradient_grad(n_par);
+  double chi2;
+  reference.FdF(datasets.par.data(), chi2, gradient.data());
+  BOOST_TEST(chi2 == serial(datasets.par.data()));
+  reference_grad.FdF(datasets.par.data(), chi2, gradient_grad.data());
+  BOOST_TEST(chi2 == serial(datasets.par.data()),
+             boost::test_tools::tolerance(1e-12));
+  for (std::size_t k = 0; k < n_par; ++k) {
+    BOOST_TEST(std::abs(gradient[k] - expected[k]) <= 1e-4 * scale);
+    BOOST_TEST(std::abs(gradient_grad[k] - expected[k]) <= 1e-4 * scale);
+  }
+  // identical for any number of threads, & per component
+  for (unsigned int n_threads : {2u, 4u, 8u}) {
+    const triumf::parallel_global_chi2 parallel(
+        datasets.chi2, datasets.parameter_index, n_threads);
+    const triumf::parallel_global_chi2 parallel_grad(
+        datasets.chi2_grad, datasets.parameter_index, n_threads);
+    std::vector<double> g(n_par);
+    parallel.Gradient(datasets.par.data(), g.data());
+    BOOST_TEST(g == gradient, boost::test_tools::per_element());
+    parallel_grad.Gradient(datasets.par.data(), g.data());
+    BOOST_TEST(g == gradient_grad, boost::test_tools::per_element());
+    for (std::size_t k = 0; k < n_par; k += 7) {
+      BOOST_TEST(parallel.Derivative(datasets.par.data(), k) == gradient[k]);
+      BOOST_TEST(parallel_grad.Derivative(datasets.par.data(), k) ==
+                 gradient_grad[k]);
+    }
+  }
+}
+
+//
+BOOST_AUTO_TEST_CASE(parallel_global_chi2_concurrent_calls) {
+  Datasets datasets(24);
+  const std::size_t n_par = datasets.par.size();
+  std::vector<std::vector<double>> par(2, datasets.par);
+  par[1][0] *= 1.0 + 1e-6;
+  par[1][3] *= 1.0 - 1e-6;
+  // reference values & gradients (from a single thread)
+  const triumf::parallel_global_chi2 chi2(datasets.chi2,
+                                          datasets.parameter_index, 4);
+  std::vector<double> value(2);
+  std::vector<std::vector<double>> gradient(2, std::vector<double>(n_par));
+  for (std::size_t s = 0; s < 2; ++s) {
+    chi2.FdF(par[s].data(), value[s], gradient[s].data());
+  }
+  // calls on the same object from several threads are serialized, such that
+  // each returns exactly the same as it would on its own
+  std::atomic<std::size_t> mismatches{0};
+  std::vector<std::thread> threads;
+  for (std::size_t t = 0; t < 4; ++t) {
+    threads.emplace_back([&, t]() {
+      for (std::size_t iteration = 0; iteration < 100; ++iteration) {
+        const std::size_t s = (t + iteration) % 2;
+        const std::size_t k = (t + 3 * iteration) % n_par;
+        if (chi2.Derivative(par[s].data(), k) != gradient[s][k]) {
+          ++mismatches;
+        }
+        if (chi2(par[1 - s].data()) != value[1 - s]) {
+          ++mismatches;
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  BOOST_TEST(mismatches.load() == 0);
+}
+
+//
+BOOST_AUTO_TEST_CASE(global_chi2_dirty_tracking) {
+  Datasets datasets(60);
+  std::vector<double> par = datasets.par;
+  triumf::global_chi2 chi2(datasets.chi2, datasets.parameter_index);
+  const double value = chi2(par.data());
+  BOOST_TEST(chi2.evaluations() == 60);
+  BOOST_TEST(chi2.skipped() == 0);
+  // nothing changed
+  BOOST_TEST(chi2(par.data()) == value);
+  BOOST_TEST(chi2.evaluations() == 60);
+  BOOST_TEST(chi2.skipped() == 60);
+  // one dataset's (local) parameter changed
+  chi2.reset_counters();
+  par[2 * 17 + 3] *= 1.0 + 1e-6;
+  const double value_local = chi2(par.data());
+  BOOST_TEST(chi2.evaluations() == 1);
+  BOOST_TEST(chi2.skipped() == 59);
+  const triumf::global_chi2 fresh(datasets.chi2, datasets.parameter_index);
+  BOOST_TEST(value_local == fresh(par.data()));
+  BOOST_TEST(value_local != value);
+  // a shared parameter changed
+  chi2.reset_counters();
+  par[0] *= 1.0 + 1e-6;
+  BOOST_TEST(chi2(par.data()) == fresh(par.data()));
+  BOOST_TEST(chi2.evaluations() == 60);
+  BOOST_TEST(chi2.skipped() == 0);
+  // forgetting the cached chi2s
+  chi2.reset_counters();
+  chi2.clear();
+  chi2(par.data());
+  BOOST_TEST(chi2.evaluations() == 60);
+  BOOST_TEST(chi2.skipped() == 0);
+  // copies start with an empty cache & their own counters
+  triumf::global_chi2 copy(chi2);
+  BOOST_TEST(copy.evaluations() == 0);
+  BOOST_TEST(copy.skipped() == 0);
+  BOOST_TEST(copy(par.data()) == chi2(par.data()));
+  BOOST_TEST(copy.evaluations() == 60);
+  BOOST_TEST(copy.skipped() == 0);
+  BOOST_TEST(chi2.skipped() == 60);
+  triumf::global_chi2 assigned(datasets.chi2, datasets.parameter_index);
+  assigned(datasets.par.data());
+  assigned = chi2;
+  BOOST_TEST(assigned.evaluations() == 0);
+  BOOST_TEST(assigned(par.data()) == chi2(par.data()));
+  BOOST_TEST(assigned.evaluations() == 60);
+  BOOST_TEST(assigned.skipped() == 0);
+}
+
+//
+BOOST_AUTO_TEST_CASE(parallel_global_chi2_dirty_tracking) {
+  Datasets datasets(60);
+  const std::size_t n_par = datasets.par.size();
+  std::vector<double> par = datasets.par;
+  // (counting the datasets' actual evaluations)
+  std::atomic<std::size_t> count{0};
+  std::vector<CountedChi2> counted;
+  counted.reserve(60);
+  std::vector<CountedChi2 *> counted_chi2;
+  for (const auto *c : datasets.chi2) {
+    counted.emplace_back(c, &count);
+    counted_chi2.push_back(&counted.back());
+  }
+  const triumf::global_chi2 serial(datasets.chi2, datasets.parameter_index);
+  triumf::parallel_global_chi2 chi2(counted_chi2, datasets.parameter_index,
+                                    4);
+  std::vector<double> gradient(n_par);
+  const double value = chi2(par.data());
+  BOOST_TEST(value == serial(par.data()));
+  BOOST_TEST(chi2.evaluations() == 60);
+  BOOST_TEST(chi2.skipped() == 0);
+  BOOST_TEST(count.load() == 60);
+  // nothing changed
+  BOOST_TEST(chi2(par.data()) == value);
+  BOOST_TEST(chi2.evaluations() == 60);
+  BOOST_TEST(chi2.skipped() == 60);
+  BOOST_TEST(count.load() == 60);
+  // the values are up to date, but the gradients are not
+  chi2.reset_counters();
+  count = 0;
+  chi2.Gradient(par.data(), gradient.data());
+  BOOST_TEST(chi2.evaluations() == 60);
+  BOOST_TEST(count.load() == 60 * (1 + 2 * 4));
+  // both are up to date
+  chi2.reset_counters();
+  count = 0;
+  BOOST_TEST(chi2(par.data()) == value);
+  chi2.Gradient(par.data(), gradient.data());
+  BOOST_TEST(chi2.evaluations() == 0);
+  BOOST_TEST(chi2.skipped() == 120);
+  BOOST_TEST(count.load() == 0);
+  // one dataset's (local) parameter changed
+  chi2.reset_counters();
+  par[2 * 17 + 3] *= 1.0 + 1e-6;
+  chi2.Gradient(par.data(), gradient.data());
+  BOOST_TEST(chi2.evaluations() == 1);
+  BOOST_TEST(chi2.skipped() == 59);
+  BOOST_TEST(count.load() == 1 + 2 * 4);
+  const double value_local = chi2(par.data());
+  BOOST_TEST(chi2.evaluations() == 1);
+  BOOST_TEST(chi2.skipped() == 119);
+  BOOST_TEST(value_local == serial(par.data()));
+  BOOST_TEST(value_local != value);
+  // ... which is identical to a full evaluation
+  const triumf::parallel_global_chi2 fresh(datasets.chi2,
+                                           datasets.parameter_index, 4);
+  std::vector<double> fresh_gradient(n_par);
+  fresh.Gradient(par.data(), fresh_gradient.data());
+  BOOST_TEST(gradient == fresh_gradient, boost::test_tools::per_element());
+  // a shared parameter changed
+  chi2.reset_counters();
+  par[0] *= 1.0 + 1e-6;
+  BOOST_TEST(chi2(par.data()) == serial(par.data()));
+  BOOST_TEST(chi2.evaluations() == 60);
+  BOOST_TEST(chi2.skipped() == 0);
+  // forgetting the cached chi2s (& gradients)
+  chi2.reset_counters();
+  chi2.clear();
+  chi2(par.data());
+  chi2.Gradient(par.data(), gradient.data());
+  BOOST_TEST(chi2.evaluations() == 120);
+  BOOST_TEST(chi2.skipped() == 0);
+  // copies start with an empty cache & their own counters
+  const std::unique_ptr<triumf::parallel_global_chi2> clone(chi2.Clone());
+  BOOST_TEST(clone->evaluations() == 0);
+  BOOST_TEST((*clone)(par.data()) == chi2(par.data()));
+  BOOST_TEST(clone->evaluations() == 60);
+  BOOST_TEST(clone->skipped() == 0);
+}
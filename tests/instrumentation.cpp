@@ -0,0 +1,131 @@
+#define BOOST_TEST_MODULE INSTRUMENTATION
+#include <boost/test/included/unit_test.hpp>
+
+#include <sstream>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+// (the instrumentation is opt-in)
+#define TRIUMF_INSTRUMENTATION
+#include <triumf/instrumentation.hpp>
+#include <triumf/nmr/hebel_slichter.hpp>
+#include <triumf/superconductivity/bcs.hpp>
+#include <triumf/superconductivity/pippard.hpp>
+
+typedef std::tuple<float, double, long double> test_types;
+
+//
+BOOST_AUTO_TEST_CASE(instrumentation_sites) {
+  namespace instrumentation = triumf::instrumentation;
+  namespace bcs = triumf::superconductivity::bcs;
+  namespace pippard = triumf::superconductivity::pippard;
+  BOOST_TEST(instrumentation::enabled);
+  instrumentation::reset();
+  BOOST_TEST(instrumentation::snapshot().empty());
+  // niobium
+  const double Tc = 9.25;
+  const double gap_meV = bcs::gap_meV<double>(Tc);
+  const double B_bcs = bcs::reduced_field_penetration<double>(
+      50.0, 5.0, Tc, gap_meV, 40.0, 100.0, 30.0, 4.0);
+  const double B_pippard = pippard::reduced_field_penetration<double>(
+      50.0, 5.0, Tc, gap_meV, 40.0, 100.0, 30.0, 4.0);
+  const double R = triumf::nmr::hebel_slichter::slr_ratio<double>(
+      5.0, Tc, gap_meV, 0.001, 0.01);
+  const double delta = bcs::reduced_gap_solver<double>(0.5);
+  //
+  const instrumentation::Snapshot records = instrumentation::snapshot();
+  const char *sites[] = {
+      "triumf::superconductivity::bcs::reduced_field_penetration",
+      "triumf::superconductivity::pippard::reduced_field_penetration",
+      "triumf::nmr::hebel_slichter::slr_ratio",
+      "triumf::superconductivity::bcs::reduced_gap_solver"};
+  for (const char *site : sites) {
+    BOOST_TEST_CONTEXT(site) {
+      BOOST_TEST(records.count(site) == 1);
+      const instrumentation::Record &r = records.at(site);
+      BOOST_TEST(r.calls >= 1);
+      BOOST_TEST(r.evaluations > 0);
+      BOOST_TEST(r.seconds > 0.0);
+    }
+  }
+  // the exp_sinh integrator reports its error and refinement levels
+  const instrumentation::Record &r =
+      records.at("triumf::nmr::hebel_slichter::slr_ratio");
+  BOOST_TEST(r.calls == 1);
+  BOOST_TEST(r.error >= 0.0);
+  BOOST_TEST(r.levels[r.max_level] == 1);
+  // the counters accumulate & don't alter the results
+  BOOST_TEST(bcs::reduced_field_penetration<double>(
+                 50.0, 5.0, Tc, gap_meV, 40.0, 100.0, 30.0, 4.0) == B_bcs);
+  BOOST_TEST(pippard::reduced_field_penetration<double>(
+                 50.0, 5.0, Tc, gap_meV, 40.0, 100.0, 30.0, 4.0) ==
+             B_pippard);
+  BOOST_TEST(triumf::nmr::hebel_slichter::slr_ratio<double>(
+                 5.0, Tc, gap_meV, 0.001, 0.01) == R);
+  BOOST_TEST(bcs::reduced_gap_solver<double>(0.5) == delta);
+  // (the Ooura integrators keep their nodes, and the gap is tabulated upon
+  // first use, so later calls are typically cheaper)
+  const instrumentation::Snapshot twice = instrumentation::snapshot();
+  for (const char *site : sites) {
+    BOOST_TEST_CONTEXT(site) {
+      BOOST_TEST(twice.at(site).calls == records.at(site).calls + 1);
+      BOOST_TEST(twice.at(site).evaluations > records.at(site).evaluations);
+    }
+  }
+  instrumentation::reset();
+  BOOST_TEST(instrumentation::snapshot().empty());
+}
+
+//
+BOOST_AUTO_TEST_CASE_TEMPLATE(instrumentation_probe, T, test_types) {
+  namespace instrumentation = triumf::instrumentation;
+  instrumentation::reset();
+  // the counters of every thread are merged (including exited threads)
+  auto work = []() {
+    for (int i = 0; i < 10; ++i) {
+      instrumentation::Probe<T> probe("probe");
+      auto square = [](T x) { return x * x; };
+      auto f = probe.counted(square);
+      for (int j = 0; j < 5; ++j) {
+        f(T(j));
+      }
+      *probe.levels() = 3;
+      probe.set_error(T(0.5));
+    }
+  };
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back(work);
+  }
+  work();
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  const instrumentation::Record r = instrumentation::snapshot().at("probe");
+  BOOST_TEST(r.calls == 50);
+  BOOST_TEST(r.evaluations == 250);
+  BOOST_TEST(r.levels[3] == 50);
+  BOOST_TEST(r.max_level == 3);
+  BOOST_TEST(r.error == 25.0);
+  BOOST_TEST(r.max_error == 0.5);
+  // JSON
+  const std::string json = instrumentation::to_json();
+  BOOST_TEST(json.find("\"probe\": {\"calls\": 50, \"evaluations\": 250, "
+                       "\"levels\": [0, 0, 0, 50], \"max_level\": 3, "
+                       "\"mean_error\": 0.5, \"max_error\": 0.5") !=
+             std::string::npos);
+  instrumentation::reset();
+  std::ostringstream empty;
+  instrumentation::dump_json(empty);
+  BOOST_TEST(empty.str() == "{}\n");
+  // a disabled probe records nothing (& passes null to the integrators)
+  {
+    instrumentation::Probe<T, false> probe("disabled");
+    BOOST_TEST(probe.error() == nullptr);
+    BOOST_TEST(probe.levels() == nullptr);
+    BOOST_TEST(probe.counted([](T x) { return x; })(T(2)) == T(2));
+  }
+  BOOST_TEST(instrumentation::snapshot().empty());
+}
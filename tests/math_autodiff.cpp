@@ -0,0 +1,127 @@
+#define BOOST_TEST_MODULE AUTODIFF
+#include <boost/test/included/unit_test.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <tuple>
+
+#include <boost/math/differentiation/autodiff.hpp>
+
+typedef std::tuple<float, double, long double> test_types;
+
+#include <triumf/bnmr/nuclei.hpp>
+#include <triumf/nmr/dipole_dipole.hpp>
+#include <triumf/nmr/nuclei.hpp>
+#include <triumf/superconductivity/bcs.hpp>
+#include <triumf/superconductivity/phenomenology.hpp>
+#include <triumf/superconductivity/pippard.hpp>
+
+// forward mode (1st order) automatic differentiation type
+template <typename T>
+using dual = boost::math::differentiation::autodiff_fvar<T, 1>;
+
+// the independent variable of a dual number
+template <typename T> dual<T> variable(T x) {
+  return boost::math::differentiation::make_fvar<T, 1>(x);
+}
+
+// compare the derivative of f (w.r.t. its argument) with central differences
+// (x must be non-zero), whose relative error is ~ epsilon^(2/3) times the
+// conditioning of f (i.e., quite poor in single precision)
+template <typename T, typename F> void check_derivative(F f, T x) {
+  const T step = std::cbrt(std::numeric_limits<T>::epsilon());
+  const T tolerance = std::max(T(1e-6), 2000 * step * step);
+  const T h = step * std::abs(x);
+  const T reference = (f(x + h) - f(x - h)) / (2 * h);
+  const dual<T> y = f(variable<T>(x));
+  BOOST_TEST(y.derivative(0) == f(x), boost::test_tools::tolerance(tolerance));
+  BOOST_TEST(y.derivative(1) == reference,
+             boost::test_tools::tolerance(tolerance));
+}
+
+//
+BOOST_AUTO_TEST_CASE_TEMPLATE(phenomenology_derivatives, T, test_types) {
+  namespace phenomenology = triumf::superconductivity::phenomenology;
+  // penetration depth vs. temperature
+  for (const T temperature : {T(1.0), T(4.0), T(8.0)}) {
+    check_derivative<T>(
+        [](auto t) {
+          using U = decltype(t);
+          return phenomenology::penetration_depth<U>(t, U(9.25), U(4.0),
+                                                     U(40.0));
+        },
+        temperature);
+  }
+  // critical temperature vs. applied field
+  check_derivative<T>(
+      [](auto b) {
+        using U = decltype(b);
+        return phenomenology::critical_temperature<U>(b, U(9.25), U(0.425));
+      },
+      T(0.1));
+}
+
+//
+BOOST_AUTO_TEST_CASE_TEMPLATE(dipole_dipole_derivatives, T, test_types) {
+  // SLR rate vs. applied field (the gyromagnetic ratios are constants)
+  for (const T applied_field : {T(1e-3), T(1e-2), T(1e-1)}) {
+    check_derivative<T>(
+        [](auto b) {
+          using U = decltype(b);
+          return triumf::nmr::dipole_dipole::slr_rate<U>(
+              b, U(1e-5), U(1.0 / 23.8e-6),
+              triumf::bnmr::nuclei::lithium_8<U>::gyromagnetic_ratio(),
+              triumf::nmr::nuclei::niobium_93<U>::gyromagnetic_ratio());
+        },
+        applied_field);
+  }
+}
+
+//
+BOOST_AUTO_TEST_CASE_TEMPLATE(bcs_derivatives, T, test_types) {
+  namespace bcs = triumf::superconductivity::bcs;
+  // kernel vs. wavevector
+  for (const T q : {T(1e-2), T(3e-2), T(1e-1)}) {
+    check_derivative<T>(
+        [](auto q) {
+          using U = decltype(q);
+          return bcs::kernel<U>(q, U(5.0), U(9.25), U(1.5), U(40.0), U(100.0),
+                                U(30.0), U(4.0));
+        },
+        q);
+  }
+  // kernel (with cached coefficients) vs. temperature
+  for (const T temperature : {T(2.0), T(5.0), T(8.0)}) {
+    check_derivative<T>(
+        [](auto t) {
+          using U = decltype(t);
+          return bcs::KernelContext<U>(t, U(9.25), U(1.5), U(40.0), U(100.0),
+                                       U(30.0), U(4.0))(U(1e-2));
+        },
+        temperature);
+  }
+  // penetration depth vs. mean free path
+  check_derivative<T>(
+      [](auto ell) {
+        using U = decltype(ell);
+        return bcs::penetration_depth<U>(U(5.0), U(9.25), U(1.5), U(40.0), ell,
+                                         U(30.0), U(4.0));
+      },
+      T(100.0));
+}
+
+//
+BOOST_AUTO_TEST_CASE_TEMPLATE(pippard_derivatives, T, test_types) {
+  namespace pippard = triumf::superconductivity::pippard;
+  // kernel vs. temperature
+  for (const T temperature : {T(2.0), T(5.0), T(8.0)}) {
+    check_derivative<T>(
+        [](auto t) {
+          using U = decltype(t);
+          return pippard::kernel<U>(U(1e-2), t, U(9.25), U(1.5), U(40.0),
+                                    U(100.0), U(30.0), U(4.0));
+        },
+        temperature);
+  }
+}
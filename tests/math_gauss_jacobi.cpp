@@ -0,0 +1,60 @@
+#define BOOST_TEST_MODULE GAUSS_JACOBI
+#include <boost/test/included/unit_test.hpp>
+
+#include <cmath>
+#include <limits>
+#include <tuple>
+
+typedef std::tuple<float, double, long double> test_types;
+
+#include <triumf/math/gauss_jacobi.hpp>
+
+//
+BOOST_AUTO_TEST_CASE_TEMPLATE(gauss_legendre, T, test_types) {
+  // a = b = 0 is the Gauss-Legendre rule
+  triumf::math::quadrature::gauss_jacobi<T> rule(3, 0.0, 0.0);
+  constexpr T tolerance = 100 * std::numeric_limits<T>::epsilon();
+
+  BOOST_TEST(rule.size() == 3);
+  BOOST_TEST(rule.abscissa().at(0) == -std::sqrt(static_cast<T>(3) / 5),
+             boost::test_tools::tolerance(tolerance));
+  BOOST_TEST(std::abs(rule.abscissa().at(1)) < tolerance);
+  BOOST_TEST(rule.abscissa().at(2) == std::sqrt(static_cast<T>(3) / 5),
+             boost::test_tools::tolerance(tolerance));
+  BOOST_TEST(rule.weights().at(0) == static_cast<T>(5) / 9,
+             boost::test_tools::tolerance(tolerance));
+  BOOST_TEST(rule.weights().at(1) == static_cast<T>(8) / 9,
+             boost::test_tools::tolerance(tolerance));
+  BOOST_TEST(rule.weights().at(2) == static_cast<T>(5) / 9,
+             boost::test_tools::tolerance(tolerance));
+}
+
+//
+BOOST_AUTO_TEST_CASE_TEMPLATE(gauss_jacobi_beta_moments, T, test_types) {
+  // moments of the beta distribution, E[y^k] = prod_j (α + j) / (α + β + j),
+  // with y = (1 + x) / 2 are integrated exactly for k < 2n
+  const T alpha = 2.3;
+  const T beta = 0.7;
+  const std::size_t n = 5;
+  triumf::math::quadrature::gauss_jacobi<T> rule(n, beta - 1.0, alpha - 1.0);
+  constexpr T tolerance = 1000 * std::numeric_limits<T>::epsilon();
+
+  T norm = rule.integrate([](T) { return 1.0; });
+  T expected = 1.0;
+  for (std::size_t k = 0; k < 2 * n; ++k) {
+    T moment = rule.integrate([k](T x) {
+                 return std::pow(0.5 * (1.0 + x), static_cast<T>(k));
+               }) /
+               norm;
+    BOOST_TEST(moment == expected, boost::test_tools::tolerance(tolerance));
+    expected *= (alpha + k) / (alpha + beta + k);
+  }
+}
+
+//
+BOOST_AUTO_TEST_CASE_TEMPLATE(gauss_jacobi_domain, T, test_types) {
+  BOOST_CHECK_THROW(triumf::math::quadrature::gauss_jacobi<T>(0, 0.0, 0.0),
+                    std::domain_error);
+  BOOST_CHECK_THROW(triumf::math::quadrature::gauss_jacobi<T>(4, -1.0, 0.0),
+                    std::domain_error);
+}
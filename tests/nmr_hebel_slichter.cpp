@@ -0,0 +1,52 @@
+#define BOOST_TEST_MODULE HEBEL_SLICHTER
+#include <boost/test/included/unit_test.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <tuple>
+#include <vector>
+
+typedef std::tuple<float, double, long double> test_types;
+
+#include <triumf/nmr/hebel_slichter.hpp>
+#include <triumf/superconductivity/bcs.hpp>
+
+//
+BOOST_AUTO_TEST_CASE_TEMPLATE(slr_ratio_engine, T, test_types) {
+  namespace hebel_slichter = triumf::nmr::hebel_slichter;
+  const T critical_temperature = 10.0;
+  const T gap_meV =
+      triumf::superconductivity::bcs::gap_meV<T>(critical_temperature);
+  // the reference (adaptive) integral is computed in double precision, as
+  // its (requested) accuracy is rather poor in single precision
+  const T tolerance =
+      std::max(T(1e-7), 1000 * std::numeric_limits<T>::epsilon());
+  const std::vector<T> temperatures = {0.5,  1.0,  4.0,  8.0,
+                                       9.99, 10.0, 15.0};
+  // the second coherence peak (at E' = Delta) lies well within the gap for
+  // the larger alpha
+  for (const T alpha : {T(0.001), T(0.05)}) {
+    for (const T Gamma : {T(0.01), T(0.1)}) {
+      const hebel_slichter::SlrRatio<T> slr_ratio(critical_temperature,
+                                                  gap_meV, alpha, Gamma);
+      for (const T temperature : temperatures) {
+        const T reference = static_cast<T>(hebel_slichter::slr_ratio<double>(
+            temperature, critical_temperature, gap_meV, alpha, Gamma));
+        BOOST_TEST(slr_ratio(temperature) == reference,
+                   boost::test_tools::tolerance(tolerance));
+      }
+      // tabulating a temperature grid gives the same values
+      const std::vector<T> ratios = slr_ratio(temperatures);
+      BOOST_TEST(ratios.size() == temperatures.size());
+      for (std::size_t i = 0; i < temperatures.size(); ++i) {
+        BOOST_TEST(ratios[i] == slr_ratio(temperatures[i]));
+      }
+      // limiting value
+      BOOST_TEST(slr_ratio(0.0) == static_cast<T>(0.0));
+    }
+  }
+  // invalid node spacing
+  BOOST_CHECK_THROW(hebel_slichter::SlrRatio<T>(critical_temperature, gap_meV,
+                                                0.001, 0.01, 0.0),
+                    std::domain_error);
+}
@@ -0,0 +1,239 @@
+#define BOOST_TEST_MODULE SPECTRAL_DENSITY
+#include <boost/test/included/unit_test.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/quadrature/gauss_kronrod.hpp>
+
+typedef std::tuple<float, double, long double> test_types;
+
+#include <triumf/nmr/spectral_density.hpp>
+
+//
+BOOST_AUTO_TEST_CASE_TEMPLATE(spectral_density_batch, T, test_types) {
+  namespace nmr = triumf::nmr;
+  using Model = typename nmr::SpectralDensity<T>::Model;
+  const T tolerance = 64 * std::numeric_limits<T>::epsilon();
+  const T strength = 2.0;
+  const T epsilon = 1.2;
+  for (const Model model :
+       {Model::j_3d, Model::j_2d, Model::j_cc, Model::j_dc, Model::j_fang,
+        Model::j_fk, Model::j_hn, Model::j_lg, Model::j_ll, Model::j_eb,
+        Model::j_bm}) {
+    const T beta = (model == Model::j_3d or model == Model::j_2d) ? 1.5 : 0.6;
+    const nmr::SpectralDensity<T> j(model, strength, beta, epsilon);
+    BOOST_TEST(j.valid());
+    for (const T tau : {T(1e-12), T(1e-9), T(1e-7), T(1e-5)}) {
+      for (const T omega : {T(1e3), T(1e6), T(1e8)}) {
+        T reference = 0.0;
+        switch (model) {
+        case Model::j_3d:
+          reference = nmr::j_3d<T>(tau, omega, strength, beta);
+          break;
+        case Model::j_2d:
+          reference = nmr::j_2d<T>(tau, omega, strength, beta);
+          break;
+        case Model::j_cc:
+          reference = nmr::j_cc<T>(tau, omega, strength, beta);
+          break;
+        case Model::j_dc:
+          reference = nmr::j_dc<T>(tau, omega, strength, beta);
+          break;
+        case Model::j_fang:
+          reference = nmr::j_fang<T>(tau, omega, strength, beta);
+          break;
+        case Model::j_fk:
+          reference = nmr::j_fk<T>(tau, omega, strength, beta);
+          break;
+        case Model::j_hn:
+          reference = nmr::j_hn<T>(tau, omega, strength, beta, epsilon);
+          break;
+        case Model::j_lg:
+          reference = nmr::j_lg<T>(tau, omega, strength, beta);
+          break;
+        case Model::j_ll:
+          reference = nmr::j_ll<T>(tau, omega, strength, beta);
+          break;
+        case Model::j_eb:
+          reference = nmr::j_eb<T>(tau, omega, strength, beta);
+          break;
+        case Model::j_bm:
+          reference = nmr::j_bm<T>(tau, omega, strength, beta, epsilon);
+          break;
+        }
+        BOOST_TEST(j(tau, omega) == reference,
+                   boost::test_tools::tolerance(tolerance));
+      }
+    }
+    // negative correlation times & frequencies
+    BOOST_TEST(j(-1e-9, 1e6) == static_cast<T>(0.0));
+    BOOST_TEST(j(1e-9, -1e6) == static_cast<T>(0.0));
+  }
+}
+
+//
+BOOST_AUTO_TEST_CASE_TEMPLATE(spectral_density_grid, T, test_types) {
+  namespace nmr = triumf::nmr;
+  using Model = typename nmr::SpectralDensity<T>::Model;
+  const T tolerance = 64 * std::numeric_limits<T>::epsilon();
+  const nmr::SpectralDensity<T> j(Model::j_cc, 2.0, 0.6);
+  const std::vector<T> temperature = {50.0, 100.0, 200.0, 300.0};
+  const std::vector<T> omega = {1e6, 1e7, 1e8};
+  const T prefactor = 1e-13;
+  const T activation_energy = 0.2;
+  const std::vector<T> grid =
+      j(temperature, omega, prefactor, activation_energy);
+  BOOST_TEST(grid.size() == temperature.size() * omega.size());
+  for (std::size_t k = 0; k < omega.size(); ++k) {
+    for (std::size_t i = 0; i < temperature.size(); ++i) {
+      const T tau = nmr::tau_c<T>(temperature[i], prefactor, activation_energy);
+      BOOST_TEST(grid[k * temperature.size() + i] ==
+                     nmr::j_cc<T>(tau, omega[k], 2.0, 0.6),
+                 boost::test_tools::tolerance(tolerance));
+    }
+  }
+  // (correlation time, frequency) pairs
+  const std::vector<T> tau =
+      nmr::tau_c<T>(temperature, prefactor, activation_energy);
+  const std::vector<T> frequency(tau.size(), omega.front());
+  const std::vector<T> pairs = j(tau, frequency);
+  for (std::size_t i = 0; i < tau.size(); ++i) {
+    BOOST_TEST(pairs[i] == grid[i]);
+  }
+  BOOST_CHECK_THROW(j(tau, omega), std::invalid_argument);
+}
+
+//
+BOOST_AUTO_TEST_CASE_TEMPLATE(spectral_density_invalid, T, test_types) {
+  namespace nmr = triumf::nmr;
+  using Model = typename nmr::SpectralDensity<T>::Model;
+  // stretching exponent(s) out of bounds
+  for (const nmr::SpectralDensity<T> &j :
+       {nmr::SpectralDensity<T>(Model::j_3d, 1.0, 2.5),
+        nmr::SpectralDensity<T>(Model::j_cc, 1.0, 1.5),
+        nmr::SpectralDensity<T>(Model::j_hn, 1.0, 0.5, 2.5),
+        nmr::SpectralDensity<T>(Model::j_fk, -1.0, 0.5),
+        nmr::SpectralDensity<T>(Model::j_lg, 1.0, 0.0),
+        nmr::SpectralDensity<T>(Model::j_bm, 1.0, 0.5, -1.0)}) {
+    BOOST_TEST(not j.valid());
+    BOOST_TEST(not j.warning().empty());
+    BOOST_TEST(j(1e-9, 1e6) == static_cast<T>(0.0));
+  }
+}
+
+//
+BOOST_AUTO_TEST_CASE_TEMPLATE(spectral_density_distributions, T, test_types) {
+  namespace nmr = triumf::nmr;
+  using Model = typename nmr::SpectralDensity<T>::Model;
+  using boost::math::quadrature::gauss_kronrod;
+  const double pi = boost::math::constants::pi<double>();
+  // the reference integrals (of sech(s + ln(ω τ)) over the distribution of
+  // s = ln(τ / τ_c)) are computed in double precision
+  const T tolerance =
+      std::max(T(1e-9), T(1e4) * std::numeric_limits<T>::epsilon());
+  const double tau = 1e-9;
+  for (const double width : {0.1, 1.0, 3.0}) {
+    const nmr::SpectralDensity<T> j_lg(Model::j_lg, 1.0, width);
+    const nmr::SpectralDensity<T> j_ll(Model::j_ll, 1.0, width);
+    const nmr::SpectralDensity<T> j_eb(Model::j_eb, 1.0, width);
+    for (const double L : {-10.0, -2.0, 0.0, 0.5, 3.0, 10.0}) {
+      const double omega = std::exp(L) / tau;
+      auto sech = [&](double s) { return 1.0 / std::cosh(s + L); };
+      // split the integrals where sech peaks
+      auto integrate = [&](auto f, double a, double b) {
+        const double c = std::min(std::max(-L, a), b);
+        return gauss_kronrod<double, 61>::integrate(f, a, c, 15, 1e-14) +
+               gauss_kronrod<double, 61>::integrate(f, c, b, 15, 1e-14);
+      };
+      const double s_max = 100.0;
+      const double lg = integrate(
+          [&](double s) {
+            return std::exp(-s * s / (2.0 * width * width)) /
+                   (width * std::sqrt(2.0 * pi)) * sech(s);
+          },
+          -s_max, s_max);
+      const double ll = integrate(
+          [&](double s) {
+            return (width / pi) / (s * s + width * width) * sech(s);
+          },
+          -s_max, s_max);
+      const double eb = integrate([&](double s) { return sech(s) / width; },
+                                  -width / 2.0, width / 2.0);
+      BOOST_TEST(j_lg(tau, omega) == static_cast<T>(lg / omega),
+                 boost::test_tools::tolerance(tolerance));
+      BOOST_TEST(j_eb(tau, omega) == static_cast<T>(eb / omega),
+                 boost::test_tools::tolerance(tolerance));
+      // (the log-Lorentzian's heavy tails are truncated in the reference)
+      BOOST_TEST(j_ll(tau, omega) == static_cast<T>(ll / omega),
+                 boost::test_tools::tolerance(std::max(tolerance, T(1e-6))));
+      // the scalar functions
+      BOOST_TEST(nmr::j_lg<T>(tau, omega, 1.0, width) == j_lg(tau, omega));
+      BOOST_TEST(nmr::j_ll<T>(tau, omega, 1.0, width) == j_ll(tau, omega));
+      BOOST_TEST(nmr::j_eb<T>(tau, omega, 1.0, width) == j_eb(tau, omega));
+    }
+  }
+  // narrow distributions -> BPP (the log-Lorentzian's heavy tails give a
+  // correction of first order in the width)
+  for (const Model model : {Model::j_lg, Model::j_ll, Model::j_eb}) {
+    const nmr::SpectralDensity<T> j(model, 1.0, 1e-3);
+    BOOST_TEST(j(1e-9, 1e9) == nmr::j_3d<T>(1e-9, 1e9, 1.0, 2.0),
+               boost::test_tools::tolerance(
+                   T(model == Model::j_ll ? 1e-3 : 1e-5)));
+  }
+  // zero frequency: ∫ G(s) e^s ds = exp(width^2 / 2) for a Gaussian
+  const auto lg = nmr::DistributedSpectralDensity<T>::log_gaussian(0.5);
+  BOOST_TEST(lg(1e-9, 0.0) == static_cast<T>(2e-9 * std::exp(0.125)),
+             boost::test_tools::tolerance(tolerance));
+}
+
+//
+BOOST_AUTO_TEST_CASE_TEMPLATE(spectral_density_bryn_mawr, T, test_types) {
+  namespace nmr = triumf::nmr;
+  using Model = typename nmr::SpectralDensity<T>::Model;
+  using boost::math::quadrature::gauss_kronrod;
+  // (see spectral_density_distributions)
+  const T tolerance =
+      std::max(T(1e-9), T(1e4) * std::numeric_limits<T>::epsilon());
+  const double tau = 1e-9;
+  const double parameters[][2] = {{1.0, 1.0}, {0.5, 2.0}, {2.0, 0.5}};
+  for (const auto &p : parameters) {
+    const double epsilon = p[0];
+    const double eta = p[1];
+    const nmr::SpectralDensity<T> j_bm(Model::j_bm, 1.0, epsilon, eta);
+    BOOST_TEST(j_bm.valid());
+    const double log_norm = std::log(eta) - std::lgamma(epsilon / eta);
+    for (const double L : {-10.0, -2.0, 0.0, 0.5, 3.0, 10.0}) {
+      const double omega = std::exp(L) / tau;
+      auto integrand = [&](double s) {
+        return std::exp(log_norm + epsilon * s - std::exp(eta * s)) /
+               std::cosh(s + L);
+      };
+      // split the integral where sech peaks
+      const double c = std::min(-L, 0.0);
+      const double bm =
+          gauss_kronrod<double, 61>::integrate(integrand, -200.0, c, 15,
+                                               1e-14) +
+          gauss_kronrod<double, 61>::integrate(integrand, c, 20.0, 15, 1e-14);
+      BOOST_TEST(j_bm(tau, omega) == static_cast<T>(bm / omega),
+                 boost::test_tools::tolerance(tolerance));
+      BOOST_TEST(nmr::j_bm<T>(tau, omega, 1.0, epsilon, eta) ==
+                 j_bm(tau, omega));
+    }
+    // zero frequency: ∫ G(s) e^s ds = Γ((ε + 1) / η) / Γ(ε / η)
+    BOOST_TEST(j_bm(tau, 0.0) ==
+                   static_cast<T>(2.0 * tau *
+                                  std::exp(std::lgamma((epsilon + 1.0) / eta) -
+                                           std::lgamma(epsilon / eta))),
+               boost::test_tools::tolerance(tolerance));
+  }
+  // ε = η = 1 is an exponential distribution of τ / τ_c (as are the scalar
+  // function's defaults)
+  BOOST_TEST(nmr::j_bm<T>(1e-9, 1e9) ==
+             nmr::SpectralDensity<T>(Model::j_bm, 1.0, 1.0, 1.0)(1e-9, 1e9));
+}
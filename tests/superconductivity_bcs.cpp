@@ -1,9 +1,12 @@
 #define BOOST_TEST_MODULE SRF
 #include <boost/test/included/unit_test.hpp>
 
+#include <algorithm>
 #include <array>
+#include <cmath>
 #include <limits>
 #include <tuple>
+#include <vector>
 
 typedef std::tuple<float, double, long double> test_types;
 
@@ -47,8 +50,86 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(bcs_gap, T, test_types) {
   }
 }
 
+//
+BOOST_AUTO_TEST_CASE_TEMPLATE(bcs_gap_table, T, test_types) {
+  // check the tabulated values against the (extended precision) root finding
+  // solutions
+  const T tolerance = std::max(static_cast<T>(1e-12),
+                               10 * std::numeric_limits<T>::epsilon());
+  constexpr std::size_t N = 1000;
+  for (std::size_t i = 1; i < N; ++i) {
+    T t = static_cast<T>(i) / N;
+    long double delta =
+        triumf::superconductivity::bcs::reduced_gap_exact<long double>(t);
+    BOOST_TEST(std::abs(triumf::superconductivity::bcs::reduced_gap<T>(t) -
+                        static_cast<T>(delta)) < tolerance);
+  }
+
+  // check the limiting behaviour close to T_c: Delta(t) ~ sqrt(3 (1 - t))
+  T one_minus_t = std::ldexp(1.0, -20);
+  BOOST_CHECK_CLOSE(
+      triumf::superconductivity::bcs::reduced_gap<T>(1.0 - one_minus_t),
+      std::sqrt(3.0 * one_minus_t), 1e-3);
+}
+
 //
 BOOST_AUTO_TEST_CASE_TEMPLATE(bcs_gap_meV, T, test_types) {
   BOOST_TEST(triumf::superconductivity::bcs::gap_meV<T>(0.0) ==
              static_cast<T>(0.0));
 }
+
+//
+BOOST_AUTO_TEST_CASE_TEMPLATE(bcs_kernel_context, T, test_types) {
+  // check that the cached coefficients reproduce the kernel exactly
+  const T temperature = 4.0;
+  const T critical_temperature = 9.25;
+  const T gap_meV =
+      triumf::superconductivity::bcs::gap_meV<T>(critical_temperature);
+  const T xi_0 = 39.0;
+  const T mean_free_path = 1e4;
+  const T lambda_0 = 40.0;
+  const T exponent = 4.0;
+  triumf::superconductivity::bcs::KernelContext<T> context(
+      temperature, critical_temperature, gap_meV, xi_0, mean_free_path,
+      lambda_0, exponent);
+
+  std::vector<T> q = {0.0, 1e-4, 1e-2, 1.0, 1e2};
+  std::vector<T> K;
+  context(q, K);
+  BOOST_TEST(K.size() == q.size());
+  for (std::size_t i = 0; i < q.size(); ++i) {
+    T expected = triumf::superconductivity::bcs::kernel<T>(
+        q.at(i), temperature, critical_temperature, gap_meV, xi_0,
+        mean_free_path, lambda_0, exponent);
+    BOOST_TEST(context(q.at(i)) == expected);
+    BOOST_TEST(K.at(i) == expected);
+  }
+}
+
+//
+BOOST_AUTO_TEST_CASE_TEMPLATE(bcs_field_profile, T, test_types) {
+  // check the profile evaluated on a depth grid against the point-wise
+  // Fourier integrals
+  T T_c = 9.25;
+  T Delta = triumf::superconductivity::bcs::gap_meV<T>(T_c);
+  T tolerance = std::max<T>(1e-6, 1e4 * std::numeric_limits<T>::epsilon());
+  std::vector<T> z;
+  for (T z_i = 0.0; z_i <= 300.0; z_i += 10.0) {
+    z.push_back(z_i);
+  }
+
+  // clean & dirty limits (i.e., long & short coherence lengths)
+  for (T mean_free_path : {1e4, 10.0}) {
+    auto accuracy = triumf::superconductivity::bcs::
+        reduced_field_penetration_accuracy<T>(z, 4.0, T_c, Delta, 39.0,
+                                              mean_free_path, 40.0, 4.0);
+    BOOST_TEST(accuracy.max_abs_error < tolerance);
+  }
+
+  // the field is unscreened in the normal state
+  std::vector<T> b = triumf::superconductivity::bcs::reduced_field_penetration<
+      T>(z, 1.1 * T_c, T_c, Delta, 39.0, 1e4, 40.0, 4.0);
+  for (auto &b_i : b) {
+    BOOST_TEST(b_i == static_cast<T>(1.0));
+  }
+}
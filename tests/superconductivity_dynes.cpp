@@ -0,0 +1,125 @@
+#define BOOST_TEST_MODULE DYNES
+#include <boost/test/included/unit_test.hpp>
+
+#include <cmath>
+#include <limits>
+#include <tuple>
+#include <vector>
+
+#include <boost/math/special_functions/next.hpp>
+
+typedef std::tuple<float, double, long double> test_types;
+
+#include <triumf/superconductivity/dynes.hpp>
+
+//
+BOOST_AUTO_TEST_CASE_TEMPLATE(dynes_real_vs_complex, T, test_types) {
+  namespace dynes = triumf::superconductivity::dynes;
+  // the complex arithmetic versions are themselves accurate to only a few
+  // ulp, so compare with a relative tolerance
+  const T tolerance = 64 * std::numeric_limits<T>::epsilon();
+  const T Delta = 1.5;
+  for (const T Gamma : {T(1e-3), T(1e-2), T(1e-1), T(1.0)}) {
+    for (int i = 0; i <= 100; ++i) {
+      const T E = 0.05 * i * Delta;
+      // avoid the (nearly) singular gap edge
+      if (std::abs(E - Delta) < 0.05 * Delta) {
+        continue;
+      }
+      BOOST_TEST(dynes::N<T>(E, Gamma, Delta) ==
+                     dynes::N_complex<T>(E, Gamma, Delta),
+                 boost::test_tools::tolerance(tolerance));
+      BOOST_TEST(dynes::M<T>(E, Gamma, Delta) ==
+                     dynes::M_complex<T>(E, Gamma, Delta),
+                 boost::test_tools::tolerance(tolerance));
+    }
+  }
+}
+
+// accuracy (in ulp) w.r.t. the complex arithmetic version in extended
+// precision, which (here) is taken as the "exact" value
+typedef std::tuple<float, double> ulp_test_types;
+
+//
+BOOST_AUTO_TEST_CASE_TEMPLATE(dynes_ulp, T, ulp_test_types) {
+  namespace dynes = triumf::superconductivity::dynes;
+  const T Delta = 1.5;
+  for (const T Gamma : {T(1e-3), T(1e-2), T(1e-1)}) {
+    for (int i = 0; i <= 500; ++i) {
+      const T E = 0.01 * i * Delta;
+      if (std::abs(E - Delta) < 0.05 * Delta) {
+        continue;
+      }
+      const T N = static_cast<T>(
+          dynes::N_complex<long double>(E, Gamma, Delta));
+      const T M = static_cast<T>(
+          dynes::M_complex<long double>(E, Gamma, Delta));
+      BOOST_TEST(std::abs(boost::math::float_distance(
+                     dynes::N<T>(E, Gamma, Delta), N)) <= 8);
+      BOOST_TEST(std::abs(boost::math::float_distance(
+                     dynes::M<T>(E, Gamma, Delta), M)) <= 8);
+    }
+  }
+}
+
+//
+BOOST_AUTO_TEST_CASE_TEMPLATE(dynes_limits, T, test_types) {
+  namespace dynes = triumf::superconductivity::dynes;
+  const T Delta = 1.5;
+  // no broadening: no states within the gap...
+  for (const T E : {T(0.0), T(0.5), T(1.0), T(1.4)}) {
+    BOOST_TEST(dynes::N<T>(E, 0.0, Delta) == static_cast<T>(0.0));
+    BOOST_TEST(dynes::M<T>(E, 0.0, Delta) == static_cast<T>(0.0));
+  }
+  // ...and the BCS density of states outside of it
+  const T tolerance = 16 * std::numeric_limits<T>::epsilon();
+  for (const T E : {T(1.6), T(2.0), T(5.0), T(50.0)}) {
+    BOOST_TEST(dynes::N<T>(E, 0.0, Delta) ==
+                   E / std::sqrt(E * E - Delta * Delta),
+               boost::test_tools::tolerance(tolerance));
+    BOOST_TEST(dynes::M<T>(E, 0.0, Delta) ==
+                   Delta / std::sqrt(E * E - Delta * Delta),
+               boost::test_tools::tolerance(tolerance));
+  }
+  // (very) large energies, e.g., in the tail of an exp-sinh quadrature
+  for (const T E : {T(1e10), T(1e30)}) {
+    BOOST_TEST(dynes::N<T>(E, 0.01, Delta) == static_cast<T>(1.0),
+               boost::test_tools::tolerance(tolerance));
+    BOOST_TEST(dynes::M<T>(E, 0.01, Delta) == Delta / E,
+               boost::test_tools::tolerance(tolerance));
+  }
+  // normal state
+  for (const T E : {T(0.0), T(0.5), T(2.0)}) {
+    BOOST_TEST(dynes::N<T>(E, 0.01, 0.0) == static_cast<T>(1.0),
+               boost::test_tools::tolerance(tolerance));
+    BOOST_TEST(dynes::M<T>(E, 0.01, 0.0) == static_cast<T>(0.0));
+  }
+}
+
+//
+BOOST_AUTO_TEST_CASE_TEMPLATE(dynes_arrays, T, test_types) {
+  namespace dynes = triumf::superconductivity::dynes;
+  const T Gamma = 0.01;
+  const T Delta = 1.5;
+  std::vector<T> E(257);
+  for (std::size_t i = 0; i < E.size(); ++i) {
+    E[i] = 0.02 * i;
+  }
+  const std::vector<T> N = dynes::N<T>(E, Gamma, Delta);
+  const std::vector<T> M = dynes::M<T>(E, Gamma, Delta);
+  std::vector<T> N_i(E.size());
+  std::vector<T> M_i(E.size());
+  dynes::N_M<T>(E.data(), E.size(), Gamma, Delta, N_i.data(), M_i.data());
+  // (vectorized loops may contract operations differently)
+  const T tolerance = 4 * std::numeric_limits<T>::epsilon();
+  BOOST_TEST(N.size() == E.size());
+  BOOST_TEST(M.size() == E.size());
+  for (std::size_t i = 0; i < E.size(); ++i) {
+    BOOST_TEST(N[i] == dynes::N<T>(E[i], Gamma, Delta),
+               boost::test_tools::tolerance(tolerance));
+    BOOST_TEST(M[i] == dynes::M<T>(E[i], Gamma, Delta),
+               boost::test_tools::tolerance(tolerance));
+    BOOST_TEST(N_i[i] == N[i], boost::test_tools::tolerance(tolerance));
+    BOOST_TEST(M_i[i] == M[i], boost::test_tools::tolerance(tolerance));
+  }
+}
@@ -1,12 +1,16 @@
 #define BOOST_TEST_MODULE SRF
 #include <boost/test/included/unit_test.hpp>
 
+#include <algorithm>
 #include <limits>
+#include <thread>
 #include <tuple>
+#include <vector>
 
 typedef std::tuple<float, double, long double> test_types;
 
 #include "triumf/superconductivity/bcs.hpp"
+#include "triumf/superconductivity/field_profile_cache.hpp"
 #include "triumf/superconductivity/pippard.hpp"
 
 //
@@ -57,3 +61,79 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(pippard_coherence_length, T, test_types) {
                  0.0 * T_c, T_c, Delta, n, xi_0, ell) == effective_xi);
 }
 
+
+//
+BOOST_AUTO_TEST_CASE_TEMPLATE(pippard_field_profile, T, test_types) {
+  // check the profile evaluated on a depth grid against the point-wise
+  // Fourier integrals
+  T T_c = 9.25;
+  T Delta = triumf::superconductivity::bcs::gap_meV<T>(T_c);
+  T tolerance = std::max<T>(1e-6, 1e4 * std::numeric_limits<T>::epsilon());
+  std::vector<T> z;
+  for (T z_i = 0.0; z_i <= 300.0; z_i += 10.0) {
+    z.push_back(z_i);
+  }
+
+  auto accuracy =
+      triumf::superconductivity::pippard::reduced_field_penetration_accuracy<
+          T>(z, 4.0, T_c, Delta, 39.0, 1e4, 40.0, 4.0);
+  BOOST_TEST(accuracy.max_abs_error < tolerance);
+
+  // the field is unscreened in the normal state
+  std::vector<T> b = triumf::superconductivity::pippard::
+      reduced_field_penetration<T>(z, 1.1 * T_c, T_c, Delta, 39.0, 1e4, 40.0,
+                                   4.0);
+  for (auto &b_i : b) {
+    BOOST_TEST(b_i == static_cast<T>(1.0));
+  }
+}
+
+//
+BOOST_AUTO_TEST_CASE_TEMPLATE(pippard_field_profile_cache, T, test_types) {
+  using cache_type = triumf::superconductivity::FieldProfileCache<T>;
+  cache_type cache(cache_type::Theory::pippard, 2, 300.0, 151);
+  T T_c = 9.25;
+  T Delta = triumf::superconductivity::bcs::gap_meV<T>(T_c);
+  T tolerance = std::max<T>(1e-6, 1e4 * std::numeric_limits<T>::epsilon());
+
+  // the first request computes the profile...
+  auto profile = cache(4.0, T_c, Delta, 39.0, 1e4, 40.0, 4.0);
+  BOOST_TEST(cache.misses() == 1);
+  BOOST_TEST(cache.hits() == 0);
+  for (T z : {0.0, 5.0, 33.3, 100.0}) {
+    BOOST_TEST(std::abs((*profile)(z) -
+                        triumf::superconductivity::pippard::
+                            reduced_field_penetration<T>(
+                                z, 4.0, T_c, Delta, 39.0, 1e4, 40.0, 4.0)) <
+               tolerance);
+  }
+
+  // ...and subsequent ones share it
+  BOOST_TEST(cache(4.0, T_c, Delta, 39.0, 1e4, 40.0, 4.0) == profile);
+  BOOST_TEST(cache.hits() == 1);
+
+  // the least recently used profile is discarded when full
+  cache(5.0, T_c, Delta, 39.0, 1e4, 40.0, 4.0);
+  cache(6.0, T_c, Delta, 39.0, 1e4, 40.0, 4.0);
+  BOOST_TEST(cache.size() == 2);
+  BOOST_TEST(cache.misses() == 3);
+  cache(4.0, T_c, Delta, 39.0, 1e4, 40.0, 4.0);
+  BOOST_TEST(cache.misses() == 4);
+
+  cache.reset_counters();
+  BOOST_TEST(cache.hits() == 0);
+  BOOST_TEST(cache.misses() == 0);
+
+  // concurrent misses on the same parameters store a single profile
+  cache.clear();
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back(
+        [&]() { cache(7.0, T_c, Delta, 39.0, 1e4, 40.0, 4.0); });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  BOOST_TEST(cache.size() == 1);
+  BOOST_TEST(cache.hits() + cache.misses() == 4);
+}